@@ -0,0 +1,96 @@
+# pyright: reportUnknownArgumentType=none, reportUnknownMemberType=none, reportUnknownVariableType=none
+
+"""
+Benchmark of memory-bound vector operations with 16-bit storage.
+
+The float16 and bfloat16 vectors store 2 bytes per element, but all
+arithmetic is computed in single precision (the values are widened when they
+are loaded and rounded when they are stored, reductions accumulate in float).
+Operations limited by the memory bandwidth should therefore be up to 4x
+faster than with the double-precision vectors, as long as the conversions are
+cheaper than the saved memory traffic.
+"""
+
+import argparse
+import time
+from collections.abc import Callable
+from typing import Any
+
+import numpy as np
+
+from pytnl.containers import Vector, add, axpy, bfloat16
+
+DEFAULT_SIZE = 50_000_000
+
+
+def benchmark(label: str, func: Callable[[], None], runs: int) -> float:
+    """Run *func* multiple times, print the best time, and return it."""
+    times: list[float] = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        func()
+        times.append(time.perf_counter() - start)
+    best = min(times)
+    print(f"{label}: {best:.6f} seconds (best of {runs})")
+    return best
+
+
+def benchmark_type(value_type: Any, element_bytes: int, n: int, runs: int) -> dict[str, float]:  # noqa: ANN401
+    """Time the operations for the given value type and print the effective bandwidth."""
+    x = Vector[value_type](n, 1.0)
+    y = Vector[value_type](n, 2.0)
+    z = Vector[value_type](n)
+
+    def add_out() -> None:
+        add(x, y, out=z)
+
+    def axpy_inplace() -> None:
+        axpy(0.5, x, y)
+
+    def sum_() -> None:
+        x.sum()
+
+    # the number of vectors read or written by each operation
+    operations: list[tuple[str, Callable[[], None], int]] = [
+        ("add(x, y, out=z)", add_out, 3),
+        ("axpy(alpha, x, y)", axpy_inplace, 3),
+        ("x.sum()", sum_, 1),
+    ]
+    results: dict[str, float] = {}
+    for label, func, streams in operations:
+        best = benchmark(label, func, runs)
+        print(f"  effective bandwidth: {streams * n * element_bytes / best / 1e9:.2f} GB/s")
+        results[label] = best
+    return results
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Compare vector operations with 64, 32 and 16-bit storage")
+    parser.add_argument("--size", type=int, default=DEFAULT_SIZE, help="Number of vector elements (default: %(default)s)")
+    parser.add_argument("--runs", type=int, default=10, help="Number of timing runs per benchmark (best of N)")
+    args = parser.parse_args()
+
+    value_types: list[tuple[str, Any, int]] = [
+        ("float64", float, 8),
+        ("float32", np.float32, 4),
+        ("float16", np.float16, 2),
+        ("bfloat16", bfloat16, 2),
+    ]
+    results: dict[str, dict[str, float]] = {}
+    for name, value_type, element_bytes in value_types:
+        print(f"\n{'=' * 50}")
+        print(name)
+        results[name] = benchmark_type(value_type, element_bytes, args.size, args.runs)
+
+    print(f"\n{'=' * 50}")
+    print("Speedup over float64")
+    baseline = results["float64"]
+    for name, times in results.items():
+        if name == "float64":
+            continue
+        speedups = ", ".join(f"{label}: {baseline[label] / best:.2f}x" for label, best in times.items())
+        print(f"{name}: {speedups}")
+
+
+if __name__ == "__main__":
+    main()
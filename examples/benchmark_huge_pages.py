@@ -0,0 +1,80 @@
+"""
+Benchmark of huge pages for large host arrays.
+
+Compares `NDArray.setValue` on a 3D array and out-of-place vector operators
+with regular pages and with transparent (or explicit) huge pages. The effect
+depends on the kernel configuration, see `/sys/kernel/mm/transparent_hugepage/enabled`
+(it must be `always` or `madvise`) and `/proc/sys/vm/nr_hugepages` for the
+explicit policy.
+"""
+
+import argparse
+import time
+from collections.abc import Callable
+
+from pytnl.containers import CachingAllocator, HugePages, NDArray, Vector
+
+DEFAULT_SHAPE = 256
+
+
+def benchmark(label: str, func: Callable[[], None], runs: int) -> float:
+    """Run *func* multiple times, print the best time, and return it."""
+    times: list[float] = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        func()
+        times.append(time.perf_counter() - start)
+    best = min(times)
+    print(f"{label}: {best:.6f} seconds (best of {runs})")
+    return best
+
+
+def benchmark_policy(policy: HugePages, n: int, runs: int) -> None:
+    """Allocate fresh containers with the given policy and time the operations."""
+    CachingAllocator.setHugePages(policy)
+    print(f"\n{'=' * 50}")
+    print(f"Huge pages: {policy.name}")
+
+    array = NDArray[3, float]()
+    array.setSizes(n, n, n)
+    # the first touch faults in the pages, which is also affected by the page size
+    benchmark("NDArray first setValue", lambda: array.setValue(1), 1)
+    benchmark("NDArray setValue", lambda: array.setValue(2), runs)
+
+    a = Vector[float](n**3)
+    b = Vector[float](n**3)
+    a.setValue(1)
+    b.setValue(2)
+
+    def add() -> None:
+        _ = a + b
+
+    def axpy() -> None:
+        nonlocal a
+        a += 2 * b
+
+    benchmark("Vector a + b", add, runs)
+    benchmark("Vector a += 2 * b", axpy, runs)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Compare regular and huge pages for large host arrays")
+    parser.add_argument("--size", type=int, default=DEFAULT_SHAPE, help="Size of each dimension of the 3D array (default: %(default)s)")
+    parser.add_argument("--runs", type=int, default=5, help="Number of timing runs per benchmark (best of N)")
+    parser.add_argument("--explicit", action="store_true", help="Also benchmark explicit huge pages (MAP_HUGETLB)")
+    parser.add_argument("--cache", action="store_true", help="Enable the caching allocator (results of operators reuse memory)")
+    args = parser.parse_args()
+
+    CachingAllocator.setEnabled(args.cache)
+    policies = [HugePages.NONE, HugePages.TRANSPARENT]
+    if args.explicit:
+        policies.append(HugePages.EXPLICIT)
+    for policy in policies:
+        benchmark_policy(policy, args.size, args.runs)
+        # release cached blocks so that the next policy gets fresh memory
+        CachingAllocator.trim()
+    CachingAllocator.setHugePages(HugePages.NONE)
+
+
+if __name__ == "__main__":
+    main()
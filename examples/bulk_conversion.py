@@ -0,0 +1,91 @@
+"""
+Compare element-wise and bulk conversions between Python data and PyTNL vectors.
+
+Filling a vector with `setElement` in a Python loop or reading it with
+`list(vector)` (which goes through `__iter__`) crosses the Python/C++ boundary
+once per element. The bulk constructor (from a sequence or any object
+supporting the buffer protocol) and `tolist()` do all the work in C++ with a
+single allocation.
+"""
+
+import argparse
+import array
+import time
+from collections.abc import Callable
+
+import numpy as np
+
+from pytnl.containers import Vector
+
+DEFAULT_SIZE = 1_000_000
+
+
+def benchmark(label: str, func: Callable[[], None], runs: int = 3) -> float:
+    """Run *func* multiple times, print the best time, and return it."""
+    times: list[float] = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        func()
+        times.append(time.perf_counter() - start)
+    best = min(times)
+    print(f"{label}: {best:.6f} seconds (best of {runs})")
+    return best
+
+
+def benchmark_import(size: int, runs: int) -> None:
+    """Compare the ways of creating a vector from Python data."""
+    data = [float(i * 1.7 + 0.3) for i in range(size)]
+    data_array = array.array("d", data)
+    data_np = np.array(data)
+    print(f"\n{'=' * 50}")
+    print(f"Creating a vector of size {size}")
+
+    def set_element_loop() -> None:
+        v = Vector[float](size)
+        for i in range(size):
+            v.setElement(i, data[i])
+
+    def from_list() -> None:
+        Vector[float](data)
+
+    def from_array() -> None:
+        Vector[float](data_array)
+
+    def from_numpy() -> None:
+        Vector[float](data_np)
+
+    baseline = benchmark("setElement loop", set_element_loop, runs)
+    for label, func in (("from list", from_list), ("from array.array", from_array), ("from NumPy array", from_numpy)):
+        best = benchmark(label, func, runs)
+        print(f"  speed-up: {baseline / best:.1f}x")
+
+
+def benchmark_export(size: int, runs: int) -> None:
+    """Compare the ways of converting a vector to a Python list."""
+    v = Vector[float](size, 1.0)
+    print(f"\n{'=' * 50}")
+    print(f"Converting a vector of size {size} to a list")
+
+    def iterator() -> None:
+        list(v)
+
+    def tolist() -> None:
+        v.tolist()
+
+    baseline = benchmark("list(vector) (iterator)", iterator, runs)
+    best = benchmark("vector.tolist()", tolist, runs)
+    print(f"  speed-up: {baseline / best:.1f}x")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Compare element-wise and bulk conversions of PyTNL vectors")
+    parser.add_argument("--size", type=int, default=DEFAULT_SIZE, help=f"Vector size (default: {DEFAULT_SIZE})")
+    parser.add_argument("--runs", type=int, default=3, help="Number of timing runs per benchmark (best of N)")
+    args = parser.parse_args()
+
+    benchmark_import(args.size, args.runs)
+    benchmark_export(args.size, args.runs)
+
+
+if __name__ == "__main__":
+    main()
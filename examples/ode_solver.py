@@ -42,14 +42,14 @@ def main() -> None:
 
     print("Solving 1D heat equation (Euler, fixed step)")
     print(f"  n={n}, h={h:.6f}, tau={tau:.6f}, final_t={final_t}")
-    print(f"  Initial: max={max(u_euler):.6f}, u[0]={u_euler[0]}, u[{n - 1}]={u_euler[n - 1]}")
+    print(f"  Initial: max={u_euler.max():.6f}, u[0]={u_euler[0]}, u[{n - 1}]={u_euler[n - 1]}")
 
     while solver_euler.getTime() < final_t:
         stop_time = min(solver_euler.getTime() + output_time_step, final_t)
         solver_euler.setStopTime(stop_time)
         solver_euler.solve(u_euler, rhs)
 
-    print(f"  Euler:   t={solver_euler.getTime():.4f}, max={max(u_euler):.6f}, u[0]={u_euler[0]}, u[{n - 1}]={u_euler[n - 1]}")
+    print(f"  Euler:   t={solver_euler.getTime():.4f}, max={u_euler.max():.6f}, u[0]={u_euler[0]}, u[{n - 1}]={u_euler[n - 1]}")
 
     # --- DormandPrince (adaptive) ---
     solver_dp = ODESolver[ode_methods.DormandPrince]()
@@ -59,14 +59,14 @@ def main() -> None:
 
     print("\nSolving 1D heat equation (DormandPrince, adaptive)")
     print(f"  n={n}, h={h:.6f}, tau={tau:.6f}, final_t={final_t}, adaptivity={adaptivity}")
-    print(f"  Initial: max={max(u_dp):.6f}, u[0]={u_dp[0]}, u[{n - 1}]={u_dp[n - 1]}")
+    print(f"  Initial: max={u_dp.max():.6f}, u[0]={u_dp[0]}, u[{n - 1}]={u_dp[n - 1]}")
 
     while solver_dp.getTime() < final_t:
         stop_time = min(solver_dp.getTime() + output_time_step, final_t)
         solver_dp.setStopTime(stop_time)
         solver_dp.solve(u_dp, rhs)
 
-    print(f"  DormandPrince: t={solver_dp.getTime():.4f}, max={max(u_dp):.6f}, u[0]={u_dp[0]}, u[{n - 1}]={u_dp[n - 1]}")
+    print(f"  DormandPrince: t={solver_dp.getTime():.4f}, max={u_dp.max():.6f}, u[0]={u_dp[0]}, u[{n - 1}]={u_dp[n - 1]}")
 
     print("\nDone — both solvers completed successfully.")
 
@@ -6,7 +6,7 @@ from typing import Any
 
 from numba import jit
 
-from pytnl.containers import Vector
+from pytnl.containers import Vector, lazy
 from pytnl.solvers import ODESolver, ode_methods
 
 
@@ -61,7 +61,7 @@ def main() -> None:
             solver.setStopTime(stop_time)
             solver.solve(u, rhs_func)
         elapsed = time.perf_counter() - start
-        print(f"{label}: {elapsed:.4f}s, max={max(u):.6f}")
+        print(f"{label}: {elapsed:.4f}s, max={u.max():.6f}")
         return u, elapsed
 
     # Warm up numba compilation (first call compiles, subsequent calls are fast)
@@ -75,7 +75,7 @@ def main() -> None:
     u_py, t_py = run_solver(rhs_python, "Pure Python RHS")
     u_nb, t_nb = run_solver(rhs_numba, "Numba JIT RHS   ")
 
-    max_diff = max(abs(u_py[i] - u_nb[i]) for i in range(n))
+    max_diff = (lazy(u_py) - u_nb).maxNorm()
     print(f"\nMax difference: {max_diff:.2e}")
     print(f"Speedup: {t_py / t_nb:.1f}x")
 
@@ -95,7 +95,7 @@ def main() -> None:
         solver_dp.setStopTime(stop_time)
         solver_dp.solve(u_dp, rhs_numba)
 
-    print(f"  t={solver_dp.getTime():.4f}, max={max(u_dp):.6f}")
+    print(f"  t={solver_dp.getTime():.4f}, max={u_dp.max():.6f}")
 
 
 if __name__ == "__main__":
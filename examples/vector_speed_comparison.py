@@ -20,11 +20,8 @@ def create_test_vectors(
     a_list = [float(i * 1.7 + 0.3) for i in range(size)]
     b_list = [float(i * 0.9 + 1.1) for i in range(size)]
 
-    a_tnl = Vector[float](size)
-    b_tnl = Vector[float](size)
-    for i in range(size):
-        a_tnl.setElement(i, a_list[i])
-        b_tnl.setElement(i, b_list[i])
+    a_tnl = Vector[float](a_list)
+    b_tnl = Vector[float](b_list)
 
     return a_list, b_list, a_tnl, b_tnl
 
@@ -84,15 +81,11 @@ def benchmark_dot(size: int, runs: int) -> None:
 
     benchmark("Python for-loop", python_dot, runs)
 
-    # TNL via DLPack → NumPy vecdot
-    # TODO: update once native TNL vector dot product is available
-    a_tnl_np = np.from_dlpack(a_tnl)
-    b_tnl_np = np.from_dlpack(b_tnl)
-
+    # TNL native dot product
     def tnl_dot() -> None:
-        np.vecdot(a_tnl_np, b_tnl_np)
+        a_tnl.dot(b_tnl)
 
-    benchmark("TNL (via NumPy vecdot)", tnl_dot, runs)
+    benchmark("TNL", tnl_dot, runs)
 
     # NumPy vecdot
     a_np = np.array(a)
@@ -117,16 +110,12 @@ def benchmark_norm(size: int, runs: int) -> None:
 
     benchmark("Python for-loop", python_norm, runs)
 
-    # TNL via DLPack → NumPy vector_norm
-    # TODO: update once native TNL vector norm is available
-    a_tnl_np = np.from_dlpack(a_tnl)
-    b_tnl_np = np.from_dlpack(b_tnl)
-
+    # TNL native l2 norm
     def tnl_norm() -> None:
-        np.linalg.vector_norm(a_tnl_np)
-        np.linalg.vector_norm(b_tnl_np)
+        a_tnl.l2Norm()
+        b_tnl.l2Norm()
 
-    benchmark("TNL (via NumPy vector_norm)", tnl_norm, runs)
+    benchmark("TNL", tnl_norm, runs)
 
     # NumPy vector_norm
     a_np = np.array(a)
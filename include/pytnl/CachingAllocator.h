@@ -0,0 +1,665 @@
+#pragma once
+
+#include <sys/mman.h>
+
+#ifdef __linux__
+   #include <linux/mempolicy.h>
+   #include <sys/syscall.h>
+   #include <unistd.h>
+#endif
+
+#ifdef HAVE_OPENMP
+   #include <omp.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <TNL/Devices/Host.h>
+
+namespace pytnl::allocators {
+
+//! \brief Policies for huge pages of large blocks.
+enum class HugePages : std::uint8_t
+{
+   None,         // regular pages
+   Transparent,  // madvise( MADV_HUGEPAGE ), the kernel may use transparent huge pages
+   Explicit,     // mmap( MAP_HUGETLB ) from the reserved pool, falls back to Transparent
+};
+
+//! \brief NUMA placement policies for the pages of large blocks.
+enum class NumaPolicy : std::uint8_t
+{
+   Default,     // pages are placed on the node of the thread which touches them first
+   FirstTouch,  // pages are touched in parallel by the static OpenMP partition right after the allocation
+   Interleave,  // pages are interleaved across all nodes (MPOL_INTERLEAVE)
+   Bind,        // pages are allocated only on the given node (MPOL_BIND)
+};
+
+/**
+ * \brief Cache of freed host memory blocks, sorted into size classes.
+ *
+ * Bindings create many short-lived arrays (results of vector operators,
+ * copies, temporaries of conversions), typically with the same sizes in every
+ * iteration of a time loop. Without caching, each of them is a `malloc`/`free`
+ * pair and large blocks are returned to the operating system by `munmap`, so
+ * their pages are faulted in again on the next use. When caching is enabled,
+ * freed blocks are kept in per-class free lists and reused by subsequent
+ * allocations of the same size class.
+ *
+ * While caching is enabled, requests are rounded up to size classes with
+ * four steps per power of two (at most 25 % overhead), so that the blocks
+ * can be reused for other requests of the same class. These blocks are
+ * recorded in a table, since caching may be disabled before they are freed.
+ * When caching is disabled (the default), blocks are allocated with the
+ * exact size. Blocks larger than `maxClassSize` are neither rounded nor
+ * cached.
+ *
+ * Small blocks are aligned to a cache line. Blocks of at least
+ * `largeBlockSize` bytes are mapped directly from the operating system with
+ * the huge page alignment (rounded up to a multiple of the huge page size),
+ * so that they can be backed by huge pages according to the `HugePages`
+ * policy. Large 3D arrays then need far fewer TLB entries. The pages of
+ * large blocks are placed on NUMA nodes according to the `NumaPolicy`. Since
+ * the policies can change at runtime, they only affect how new blocks are
+ * mapped, never how existing blocks are released.
+ *
+ * Note that each extension module has its own instance (the symbols are not
+ * exported), but the modules replace it with the instance of the _containers
+ * module when they are imported (see `pytnl/caching_pool.h`), so that the
+ * cache and the tables of blocks are common to the whole process. Blocks
+ * allocated before that have the exact size (caching can be enabled only
+ * through the instance of _containers), so they may be freed by any
+ * instance.
+ */
+class CachingPool
+{
+public:
+   struct Statistics
+   {
+      //! \brief Number of allocations served from the cache.
+      std::size_t hits = 0;
+      //! \brief Number of allocations which had to allocate new memory.
+      std::size_t misses = 0;
+      //! \brief Number of freed blocks returned to the system (not cached).
+      std::size_t releases = 0;
+      //! \brief Number of blocks currently held in the cache.
+      std::size_t cachedBlocks = 0;
+      //! \brief Number of bytes currently held in the cache.
+      std::size_t cachedBytes = 0;
+      //! \brief Number of blocks currently shared by copy-on-write copies.
+      std::size_t sharedBlocks = 0;
+   };
+
+   //! \brief Alignment of all blocks (a cache line), blocks of all value types are interchangeable.
+   static constexpr std::size_t alignment = 64;
+   //! \brief Size of the smallest class.
+   static constexpr std::size_t minClassBits = 6;
+   //! \brief Sizes above `1 << maxClassBits` bytes are not cached.
+   static constexpr std::size_t maxClassBits = 36;
+   static constexpr std::size_t maxClassSize = std::size_t{ 1 } << maxClassBits;
+   static constexpr std::size_t classCount = 1 + 4 * ( maxClassBits - minClassBits );
+   //! \brief Blocks of at least this size are mapped directly (the size of huge pages on x86-64).
+   static constexpr std::size_t largeBlockSize = std::size_t{ 1 } << 21;
+   //! \brief Granularity of the first touch (the smallest page size).
+   static constexpr std::size_t pageSize = 4096;
+
+   static CachingPool&
+   getInstance()
+   {
+      return *getInstancePointer().load( std::memory_order_acquire );
+   }
+
+   //! \brief Replaces the instance used by this module with the instance of another module.
+   static void
+   setInstance( CachingPool& pool )
+   {
+      getInstancePointer().store( &pool, std::memory_order_release );
+   }
+
+   //! \brief Returns the index of the size class for `bytes` (must be at most `maxClassSize`).
+   static constexpr std::size_t
+   getSizeClass( std::size_t bytes )
+   {
+      if( bytes <= ( std::size_t{ 1 } << minClassBits ) )
+         return 0;
+      // 2^e < bytes <= 2^(e+1), split into 4 steps of 2^(e-2) bytes
+      std::size_t e = minClassBits;
+      while( ( bytes - 1 ) >> ( e + 1 ) != 0 )
+         e++;
+      const std::size_t step = std::size_t{ 1 } << ( e - 2 );
+      const std::size_t sub = ( bytes - ( std::size_t{ 1 } << e ) + step - 1 ) / step;
+      return 1 + 4 * ( e - minClassBits ) + sub - 1;
+   }
+
+   //! \brief Returns the size in bytes of blocks in the given size class.
+   static constexpr std::size_t
+   getClassSize( std::size_t sizeClass )
+   {
+      if( sizeClass == 0 )
+         return std::size_t{ 1 } << minClassBits;
+      const std::size_t e = ( sizeClass - 1 ) / 4 + minClassBits;
+      const std::size_t sub = ( sizeClass - 1 ) % 4 + 1;
+      return ( std::size_t{ 1 } << e ) + sub * ( std::size_t{ 1 } << ( e - 2 ) );
+   }
+
+   [[nodiscard]] void*
+   allocate( std::size_t bytes )
+   {
+      // blocks are rounded up to their size class only when they can be cached
+      if( bytes > maxClassSize || ! enabled.load( std::memory_order_relaxed ) )
+         return allocateBlock( bytes );
+
+      const std::size_t sizeClass = getSizeClass( bytes );
+      {
+         std::lock_guard< std::mutex > lock( mutex );
+         auto& list = freeLists[ sizeClass ];
+         if( ! list.empty() ) {
+            void* block = list.back();
+            list.pop_back();
+            statistics.hits++;
+            statistics.cachedBlocks--;
+            statistics.cachedBytes -= getClassSize( sizeClass );
+            return block;
+         }
+         statistics.misses++;
+      }
+      void* block = allocateBlock( getClassSize( sizeClass ), bytes );
+      try {
+         std::lock_guard< std::mutex > lock( mutex );
+         classBlocks.insert( block );
+         classBlockCount.store( classBlocks.size(), std::memory_order_relaxed );
+      }
+      catch( ... ) {
+         releaseBlock( block, getClassSize( sizeClass ) );
+         throw;
+      }
+      return block;
+   }
+
+   void
+   deallocate( void* block, std::size_t bytes ) noexcept
+   {
+      // shared blocks are released by their last owner
+      if( sharedCount.load( std::memory_order_relaxed ) != 0 && releaseShare( block ) )
+         return;
+      if( exportedCount.load( std::memory_order_relaxed ) != 0 )
+         releaseExport( block );
+      // blocks with reserved capacity are larger than the array owning them
+      if( capacityCount.load( std::memory_order_relaxed ) != 0 )
+         bytes = releaseCapacity( block, bytes );
+
+      // blocks with the exact size (allocated while caching was disabled) are not cached
+      if( bytes > maxClassSize || classBlockCount.load( std::memory_order_relaxed ) == 0 ) {
+         releaseBlock( block, bytes );
+         return;
+      }
+
+      const std::size_t sizeClass = getSizeClass( bytes );
+      const std::size_t classSize = getClassSize( sizeClass );
+      {
+         std::lock_guard< std::mutex > lock( mutex );
+         auto iter = classBlocks.find( block );
+         if( iter != classBlocks.end() ) {
+            if( enabled.load( std::memory_order_relaxed ) ) {
+               if( statistics.cachedBytes + classSize <= maxCachedBytes ) {
+                  try {
+                     // the block stays in classBlocks while it is cached
+                     freeLists[ sizeClass ].push_back( block );
+                     statistics.cachedBlocks++;
+                     statistics.cachedBytes += classSize;
+                     return;
+                  }
+                  catch( const std::bad_alloc& ) {
+                     // fall through and release the block
+                  }
+               }
+               statistics.releases++;
+            }
+            classBlocks.erase( iter );
+            classBlockCount.store( classBlocks.size(), std::memory_order_relaxed );
+            bytes = classSize;
+         }
+      }
+      releaseBlock( block, bytes );
+   }
+
+   /**
+    * \brief Registers another owner of `block`, which is then released only by
+    * the last call of `deallocate`. Used for the copy-on-write copies of arrays.
+    */
+   void
+   share( void* block )
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      sharedBlocks[ block ]++;
+      statistics.sharedBlocks = sharedBlocks.size();
+      sharedCount.store( sharedBlocks.size(), std::memory_order_relaxed );
+   }
+
+   //! \brief Returns `true` if `block` has more than one owner.
+   [[nodiscard]] bool
+   isShared( const void* block )
+   {
+      if( sharedCount.load( std::memory_order_relaxed ) == 0 )
+         return false;
+      std::lock_guard< std::mutex > lock( mutex );
+      return sharedBlocks.count( const_cast< void* >( block ) ) > 0;
+   }
+
+   /**
+    * \brief Records that a writable view or export (e.g. a NumPy array) of
+    * `block` may exist. Such blocks are not shared by copy-on-write copies,
+    * since the writes through the export would be visible in all copies. The
+    * mark is removed when the block is released.
+    */
+   void
+   setExported( void* block )
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      exportedBlocks.insert( block );
+      exportedCount.store( exportedBlocks.size(), std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] bool
+   isExported( const void* block )
+   {
+      if( exportedCount.load( std::memory_order_relaxed ) == 0 )
+         return false;
+      std::lock_guard< std::mutex > lock( mutex );
+      return exportedBlocks.count( const_cast< void* >( block ) ) > 0;
+   }
+
+   /**
+    * \brief Records that `block` was allocated with `bytes` bytes for an array
+    * which uses only a part of it (the rest is the capacity reserved for
+    * appending). `deallocate` then releases the block with the recorded size.
+    */
+   void
+   setCapacity( void* block, std::size_t bytes )
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      capacities[ block ] = bytes;
+      capacityCount.store( capacities.size(), std::memory_order_relaxed );
+   }
+
+   //! \brief Returns the recorded size of `block`, or `bytes` if it was allocated with the size of its array.
+   [[nodiscard]] std::size_t
+   getCapacity( const void* block, std::size_t bytes )
+   {
+      if( capacityCount.load( std::memory_order_relaxed ) == 0 )
+         return bytes;
+      std::lock_guard< std::mutex > lock( mutex );
+      auto iter = capacities.find( const_cast< void* >( block ) );
+      return iter == capacities.end() ? bytes : iter->second;
+   }
+
+   //! \brief Enables or disables the copy-on-write mode of `__copy__` for host arrays.
+   void
+   setCopyOnWrite( bool value )
+   {
+      copyOnWrite.store( value, std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] bool
+   isCopyOnWrite() const
+   {
+      return copyOnWrite.load( std::memory_order_relaxed );
+   }
+
+   //! \brief Enables or disables caching, disabling also releases all cached blocks.
+   void
+   setEnabled( bool value )
+   {
+      enabled.store( value, std::memory_order_relaxed );
+      if( ! value )
+         trim();
+   }
+
+   [[nodiscard]] bool
+   isEnabled() const
+   {
+      return enabled.load( std::memory_order_relaxed );
+   }
+
+   //! \brief Sets the limit of the cache size, blocks freed above the limit are released.
+   void
+   setMaxCachedBytes( std::size_t bytes )
+   {
+      {
+         std::lock_guard< std::mutex > lock( mutex );
+         maxCachedBytes = bytes;
+      }
+      if( getStatistics().cachedBytes > bytes )
+         trim();
+   }
+
+   [[nodiscard]] std::size_t
+   getMaxCachedBytes()
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      return maxCachedBytes;
+   }
+
+   //! \brief Releases all cached blocks to the system.
+   void
+   trim()
+   {
+      std::array< std::vector< void* >, classCount > lists;
+      {
+         std::lock_guard< std::mutex > lock( mutex );
+         lists.swap( freeLists );
+         for( const auto& list : lists )
+            for( void* block : list )
+               classBlocks.erase( block );
+         classBlockCount.store( classBlocks.size(), std::memory_order_relaxed );
+         statistics.releases += statistics.cachedBlocks;
+         statistics.cachedBlocks = 0;
+         statistics.cachedBytes = 0;
+      }
+      for( std::size_t sizeClass = 0; sizeClass < classCount; sizeClass++ )
+         for( void* block : lists[ sizeClass ] )
+            releaseBlock( block, getClassSize( sizeClass ) );
+   }
+
+   //! \brief Sets the huge page policy for new blocks of at least `threshold` bytes.
+   void
+   setHugePages( HugePages policy, std::size_t threshold )
+   {
+      hugePages.store( policy, std::memory_order_relaxed );
+      hugePageThreshold.store( threshold, std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] HugePages
+   getHugePages() const
+   {
+      return hugePages.load( std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] std::size_t
+   getHugePageThreshold() const
+   {
+      return hugePageThreshold.load( std::memory_order_relaxed );
+   }
+
+   //! \brief Sets the NUMA policy for new large blocks, `node` is used only by `NumaPolicy::Bind`.
+   void
+   setNumaPolicy( NumaPolicy policy, int node )
+   {
+      numaNode.store( node, std::memory_order_relaxed );
+      numaPolicy.store( policy, std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] NumaPolicy
+   getNumaPolicy() const
+   {
+      return numaPolicy.load( std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] int
+   getNumaNode() const
+   {
+      return numaNode.load( std::memory_order_relaxed );
+   }
+
+   [[nodiscard]] Statistics
+   getStatistics()
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      return statistics;
+   }
+
+   //! \brief Resets the counters of hits, misses and releases.
+   void
+   resetStatistics()
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      statistics.hits = statistics.misses = statistics.releases = 0;
+   }
+
+private:
+   CachingPool() = default;
+
+   static std::atomic< CachingPool* >&
+   getInstancePointer()
+   {
+      // intentionally leaked: arrays may be destroyed during interpreter
+      // shutdown, after the destructors of static objects have run
+      static std::atomic< CachingPool* > pool = new CachingPool;
+      return pool;
+   }
+
+   //! \brief Drops one owner of a shared block, returns `false` if the block is not shared.
+   bool
+   releaseShare( void* block ) noexcept
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      auto iter = sharedBlocks.find( block );
+      if( iter == sharedBlocks.end() )
+         return false;
+      if( --iter->second == 0 ) {
+         sharedBlocks.erase( iter );
+         statistics.sharedBlocks = sharedBlocks.size();
+         sharedCount.store( sharedBlocks.size(), std::memory_order_relaxed );
+      }
+      return true;
+   }
+
+   //! \brief Removes the export mark of a block which is being released.
+   void
+   releaseExport( void* block ) noexcept
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      exportedBlocks.erase( block );
+      exportedCount.store( exportedBlocks.size(), std::memory_order_relaxed );
+   }
+
+   //! \brief Removes the recorded size of a block which is being released, returns the size of the block.
+   std::size_t
+   releaseCapacity( void* block, std::size_t bytes ) noexcept
+   {
+      std::lock_guard< std::mutex > lock( mutex );
+      auto iter = capacities.find( block );
+      if( iter == capacities.end() )
+         return bytes;
+      bytes = iter->second;
+      capacities.erase( iter );
+      capacityCount.store( capacities.size(), std::memory_order_relaxed );
+      return bytes;
+   }
+
+   static constexpr std::size_t
+   getMappingSize( std::size_t blockSize )
+   {
+      return ( blockSize + largeBlockSize - 1 ) / largeBlockSize * largeBlockSize;
+   }
+
+   /**
+    * \brief Allocates a new block of `blockSize` bytes from the system.
+    *
+    * `bytes` is the size requested by the array (at most `blockSize`), which
+    * determines the partition of the pages for the `FirstTouch` policy.
+    */
+   [[nodiscard]] void*
+   allocateBlock( std::size_t blockSize, std::size_t bytes = 0 )
+   {
+      if( bytes == 0 )
+         bytes = blockSize;
+      if( blockSize < largeBlockSize )
+         return ::operator new( blockSize, std::align_val_t{ alignment } );
+
+      const std::size_t length = getMappingSize( blockSize );
+      HugePages policy = hugePages.load( std::memory_order_relaxed );
+      if( blockSize < hugePageThreshold.load( std::memory_order_relaxed ) )
+         policy = HugePages::None;
+
+#ifdef MAP_HUGETLB
+      if( policy == HugePages::Explicit ) {
+         void* block = ::mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+         if( block != MAP_FAILED ) {
+            placePages( block, length, bytes );
+            return block;
+         }
+         // no reserved huge pages are available
+         policy = HugePages::Transparent;
+      }
+#endif
+
+      // over-allocate and unmap the unaligned head and the tail
+      void* mapping = ::mmap( nullptr, length + largeBlockSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+      if( mapping == MAP_FAILED )
+         throw std::bad_alloc();
+      const auto begin = reinterpret_cast< std::uintptr_t >( mapping );
+      const auto aligned = ( begin + largeBlockSize - 1 ) / largeBlockSize * largeBlockSize;
+      const std::size_t head = aligned - begin;
+      if( head > 0 )
+         ::munmap( mapping, head );
+      ::munmap( reinterpret_cast< void* >( aligned + length ), largeBlockSize - head );
+
+      void* block = reinterpret_cast< void* >( aligned );
+#ifdef MADV_HUGEPAGE
+      if( policy != HugePages::None )
+         ::madvise( block, length, MADV_HUGEPAGE );
+#endif
+      placePages( block, length, bytes );
+      return block;
+   }
+
+   //! \brief Applies the NUMA policy to a new mapping (before any of its pages is touched), `bytes` bytes of it are used.
+   void
+   placePages( void* block, std::size_t length, std::size_t bytes ) const
+   {
+      const NumaPolicy policy = numaPolicy.load( std::memory_order_relaxed );
+      if( policy == NumaPolicy::Interleave || policy == NumaPolicy::Bind ) {
+#if defined( __linux__ ) && defined( SYS_mbind )
+         const unsigned long mask =
+            policy == NumaPolicy::Interleave ? ~0UL : 1UL << numaNode.load( std::memory_order_relaxed );
+         const int mode = policy == NumaPolicy::Interleave ? MPOL_INTERLEAVE : MPOL_BIND;
+         // the kernel intersects the mask with the allowed nodes, a failure
+         // (e.g. a kernel without NUMA support) leaves the default placement
+         ::syscall( SYS_mbind, block, length, mode, &mask, 8 * sizeof( mask ) + 1, 0 );
+#endif
+      }
+      else if( policy == NumaPolicy::FirstTouch ) {
+         // partition the used bytes [0, bytes) with the same static schedule
+         // as TNL's parallelFor partitions the elements, each page is touched
+         // by the thread whose part contains its first byte, so each thread
+         // later works on local memory (the rest of the mapping, e.g. the
+         // rounding of the size class, is left to the default placement)
+         volatile char* data = static_cast< char* >( block );
+#ifdef HAVE_OPENMP
+   #pragma omp parallel if( TNL::Devices::Host::isOMPEnabled() )
+#endif
+         {
+            std::size_t threads = 1;
+            std::size_t thread = 0;
+#ifdef HAVE_OPENMP
+            threads = omp_get_num_threads();
+            thread = omp_get_thread_num();
+#endif
+            const std::size_t chunk = bytes / threads;
+            const std::size_t rest = bytes % threads;
+            const std::size_t begin = thread * chunk + std::min( thread, rest );
+            const std::size_t end = begin + chunk + ( thread < rest ? 1 : 0 );
+            for( std::size_t page = ( begin + pageSize - 1 ) / pageSize; page * pageSize < end; page++ )
+               data[ page * pageSize ] = 0;
+         }
+      }
+   }
+
+   //! \brief Returns a block of `blockSize` bytes allocated by `allocateBlock` to the system.
+   static void
+   releaseBlock( void* block, std::size_t blockSize ) noexcept
+   {
+      if( blockSize < largeBlockSize )
+         ::operator delete( block, std::align_val_t{ alignment } );
+      else
+         ::munmap( block, getMappingSize( blockSize ) );
+   }
+
+   std::atomic< bool > enabled = false;
+   std::atomic< HugePages > hugePages = HugePages::None;
+   std::atomic< std::size_t > hugePageThreshold = largeBlockSize;
+   std::atomic< NumaPolicy > numaPolicy = NumaPolicy::Default;
+   std::atomic< int > numaNode = 0;
+   std::atomic< bool > copyOnWrite = false;
+   // number of entries in sharedBlocks, checked without locking the mutex
+   std::atomic< std::size_t > sharedCount = 0;
+   // number of entries in exportedBlocks, checked without locking the mutex
+   std::atomic< std::size_t > exportedCount = 0;
+   // number of entries in capacities, checked without locking the mutex
+   std::atomic< std::size_t > capacityCount = 0;
+   // number of entries in classBlocks, checked without locking the mutex
+   std::atomic< std::size_t > classBlockCount = 0;
+   std::mutex mutex;
+   std::size_t maxCachedBytes = std::size_t{ 1 } << 30;
+   std::array< std::vector< void* >, classCount > freeLists;
+   // the number of additional owners of each shared block
+   std::unordered_map< void*, std::size_t > sharedBlocks;
+   // blocks which may have writable views or exports
+   std::unordered_set< void* > exportedBlocks;
+   // the allocated size of blocks with reserved capacity
+   std::unordered_map< void*, std::size_t > capacities;
+   // blocks allocated with the size of their class (in use or cached)
+   std::unordered_set< void* > classBlocks;
+   Statistics statistics;
+};
+
+/**
+ * \brief Allocator for the host memory which obtains the blocks from the
+ * \ref CachingPool. It is stateless and all instances are interchangeable.
+ */
+template< typename T >
+struct CachingHost
+{
+   static_assert( alignof( T ) <= CachingPool::alignment, "the value type is over-aligned for the caching pool" );
+
+   using value_type = T;
+   using size_type = std::size_t;
+   using difference_type = std::ptrdiff_t;
+
+   CachingHost() = default;
+
+   template< typename U >
+   CachingHost( const CachingHost< U >& ) noexcept
+   {}
+
+   [[nodiscard]] T*
+   allocate( size_type n )
+   {
+      if( n > std::numeric_limits< size_type >::max() / sizeof( T ) )
+         throw std::bad_array_new_length();
+      return static_cast< T* >( CachingPool::getInstance().allocate( n * sizeof( T ) ) );
+   }
+
+   void
+   deallocate( T* ptr, size_type n ) noexcept
+   {
+      CachingPool::getInstance().deallocate( ptr, n * sizeof( T ) );
+   }
+};
+
+template< typename T, typename U >
+bool
+operator==( const CachingHost< T >&, const CachingHost< U >& ) noexcept
+{
+   return true;
+}
+
+template< typename T, typename U >
+bool
+operator!=( const CachingHost< T >&, const CachingHost< U >& ) noexcept
+{
+   return false;
+}
+
+}  // namespace pytnl::allocators
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Python.h>
+
+#include <nanobind/nanobind.h>
+
+#include <pytnl/CachingAllocator.h>
+
+/* Each PyTNL extension module has its own instance of the caching pool,
+ * because the modules are built with hidden symbol visibility. The _containers
+ * module exports its instance in a capsule and the other modules switch to it
+ * when they are imported, so that the cached blocks, the policies and the
+ * blocks shared by copy-on-write copies are common to all modules.
+ */
+inline void
+export_caching_pool( nanobind::module_& m )
+{
+   m.attr( "_caching_pool" ) =
+      nanobind::capsule( &pytnl::allocators::CachingPool::getInstance(), "pytnl._containers._caching_pool" );
+}
+
+//! \brief Switches to the caching pool of the _containers module (which must be imported first).
+inline void
+import_caching_pool()
+{
+   void* pool = PyCapsule_Import( "pytnl._containers._caching_pool", 0 );
+   if( pool == nullptr )
+      throw nanobind::python_error();
+   pytnl::allocators::CachingPool::setInstance( *static_cast< pytnl::allocators::CachingPool* >( pool ) );
+}
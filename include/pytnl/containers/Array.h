@@ -1,14 +1,28 @@
 #pragma once
 
+#include <pytnl/gil.h>
 #include <pytnl/pytnl.h>
 
 #include <TNL/Containers/Array.h>
 #include <TNL/Allocators/CudaHost.h>
 #include <TNL/Allocators/CudaManaged.h>
 
+#include "append.h"
+#include "BitArray.h"
+#include "copy_on_write.h"
 #include "dlpack.h"
+#include "external_views.h"
 #include "indexing.h"
+#include "mapped_file.h"
+#include "shared_memory.h"
+#include "pickle.h"
+#include "random.h"
 #include "buffer_protocol.h"
+#include "compression.h"
+#include "conversion.h"
+#include "scan.h"
+#include "sort.h"
+#include "StridedArrayView.h"
 
 template< typename ArrayType >
 void
@@ -51,7 +65,7 @@ export_Array( nb::module_& m, const char* name )
                else if constexpr( std::is_integral_v< ValueType > ) {
                   return nb::borrow( &PyLong_Type );
                }
-               else if constexpr( std::is_floating_point_v< ValueType > ) {
+               else if constexpr( std::is_floating_point_v< ValueType > || pytnl::is_half_v< ValueType > ) {
                   return nb::borrow( &PyFloat_Type );
                }
                else if constexpr( TNL::is_complex_v< ValueType > ) {
@@ -80,6 +94,7 @@ export_Array( nb::module_& m, const char* name )
             []( ArrayType& array, IndexType begin = 0, IndexType end = 0 )
             {
                check_array_range( array.getSize(), begin, end );
+               pytnl::containers::detach_for_export( array );
                return array.getView( begin, end );
             },
             nb::arg( "begin" ) = 0,
@@ -108,6 +123,7 @@ export_Array( nb::module_& m, const char* name )
                   throw nb::type_error( "Cannot set element of a constant array" );
                else {
                   check_array_index( array.getSize(), i );
+                  pytnl::containers::detach( array );
                   array.setElement( i, value );
                }
             },
@@ -128,13 +144,32 @@ export_Array( nb::module_& m, const char* name )
                {
                   if constexpr( std::is_const_v< ValueType > )
                      throw nb::type_error( "Cannot assign into constant array" );
-                  else
+                  else {
+                     pytnl::containers::detach( array );
+                     pytnl::gil_release_for_size release( other.getSize() );
                      return array = other;
+                  }
                } )
 
          // Comparison
-         .def( nb::self == nb::self, nb::sig( "def __eq__(self, arg: object, /) -> bool" ) )
-         .def( nb::self != nb::self, nb::sig( "def __ne__(self, arg: object, /) -> bool" ) )
+         .def(
+            "__eq__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return self == other;
+            },
+            nb::sig( "def __eq__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
+         .def(
+            "__ne__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return self != other;
+            },
+            nb::sig( "def __ne__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
 
          // Fill
          .def(
@@ -145,6 +180,8 @@ export_Array( nb::module_& m, const char* name )
                   throw nb::type_error( "Cannot set value of constant array" );
                else {
                   check_array_range( array.getSize(), begin, end );
+                  pytnl::containers::detach( array );
+                  pytnl::gil_release_for_size release( array.getSize() );
                   array.setValue( value, begin, end );
                }
             },
@@ -152,16 +189,44 @@ export_Array( nb::module_& m, const char* name )
             nb::arg( "begin" ) = 0,
             nb::arg( "end" ) = 0 )
 
-         // File I/O
-         .def( "save", &ArrayType::save, nb::arg( "filename" ) )
+         // File I/O (the GIL is released regardless of the array size)
+         .def(
+            "save",
+            []( const ArrayType& array, const std::string& filename, bool aligned )
+            {
+               nb::gil_scoped_release release;
+               if( ! aligned )
+                  array.save( filename );
+               else if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+                  pytnl::containers::write_aligned_array( filename, array.getData(), array.getSize() );
+               else {
+                  TNL::Containers::Array< std::remove_const_t< ValueType >, TNL::Devices::Host, IndexType > host;
+                  host = array.getConstView();
+                  pytnl::containers::write_aligned_array( filename, host.getData(), host.getSize() );
+               }
+            },
+            nb::arg( "filename" ),
+            nb::kw_only(),
+            nb::arg( "aligned" ) = false,
+            "Saves the array to a file.\n\n"
+            "By default, the file has the TNL format. With `aligned=True`, the data in the file are padded "
+            "to a 64-byte boundary, so that `ArrayView.loadMapped` can map them in place (the data in TNL "
+            "files are generally misaligned for 8- and 16-byte elements). Both formats are read by `load`." )
          .def(
             "load",
             []( ArrayType& array, const std::string& filename )
             {
                if constexpr( std::is_const_v< ValueType > )
                   throw nb::type_error( "Cannot load into constant array" );
-               else
-                  return array.load( filename );
+               else {
+                  pytnl::containers::detach( array );
+                  if( pytnl::containers::is_aligned_file( filename ) ) {
+                     pytnl::containers::load_aligned_array( array, filename );
+                     return;
+                  }
+                  nb::gil_scoped_release release;
+                  array.load( filename );
+               }
             },
             nb::arg( "filename" ) )
 
@@ -186,6 +251,8 @@ export_Array( nb::module_& m, const char* name )
                // FIXME: DLPack support switching CUDA devices but TNL does not
                if constexpr( std::is_same_v< DeviceType, TNL::Devices::Cuda > )
                   device_id = TNL::Backend::getDevice();
+               // the consumer may write into the data
+               pytnl::containers::detach_for_export( *self.p );
 
                using array_api_t = nb::ndarray< nb::array_api, ValueType >;
                array_api_t array_api(
@@ -207,35 +274,89 @@ export_Array( nb::module_& m, const char* name )
 
    def_indexing< ArrayType >( array );
 
+   def_slice_indexing< ArrayType >( array );
+
+   // bulk conversion to a list (faster than list(array), which uses __iter__)
+   def_tolist< ArrayType >( array );
+
+   // in-place prefix sums (inherited by vectors)
+   def_scans( array );
+
+   // sorting and binary search (inherited by vectors)
+   def_sorting( array );
+   def_compressed_serialization( array );
+
+   // setValue with a BitArray mask (inherited by vectors)
+   if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+      def_masked_operations( array );
+
+   // random fills (inherited by vectors)
+   if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > && ! std::is_const_v< ValueType >
+                 && std::is_floating_point_v< pytnl::compute_type_t< ValueType > > )
+   {
+      def_random_fill( array,
+                       []( ArrayType& self )
+                       {
+                          return self.getView();
+                       } );
+   }
+
    if constexpr( TNL::IsViewType< ArrayType >::value ) {
       array  //
          .def( nb::init< const ArrayType& >() )
-         // FIXME: needed for implicit conversion from Array, but AllocatorType is ignored
-         .def( nb::init_implicit< TNL::Containers::Array< std::remove_const_t< ValueType >, DeviceType, IndexType >& >() )
          .def(
             "bind",
             []( ArrayType& self, const ArrayType& other )
             {
                self.bind( other );
             } );
+      // FIXME: needed for implicit conversion from Array, but AllocatorType is ignored
+      def_view_from_array< ArrayType, pytnl::Array< std::remove_const_t< ValueType >, DeviceType, IndexType > >( array );
+      if constexpr( std::is_const_v< ValueType > ) {
+         // implicit conversion from the non-const view
+         array.def( nb::init_implicit< TNL::Containers::ArrayView< std::remove_const_t< ValueType >, DeviceType, IndexType > >() );
+      }
+      def_external_view_constructor< ArrayType >( array );
+      if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+         def_mapped_file< ArrayType >( array );
+         def_shared_memory< ArrayType >( array );
+      }
    }
    else {
-      // TODO: slicing should work for views too
-      def_slice_indexing< ArrayType >( array );
-
       // Additional Array-specific methods
       array
          // NOTE: the nb::init<...> does not work due to list-initialization and
          //       std::list_initializer constructor in ArrayType
          .def( my_init< IndexType >(), nb::arg( "size" ) )
-         .def( my_init< IndexType, ValueType >(), nb::arg( "size" ), nb::arg( "value" ) )
+         .def(
+            "__init__",
+            []( ArrayType* self, IndexType size, ValueType value )
+            {
+               pytnl::gil_release_for_size release( size );
+               new( self ) ArrayType( size, value );
+            },
+            nb::arg( "size" ),
+            nb::arg( "value" ) );
+      def_bulk_constructor< ArrayType >( array );
 
+      // amortized growth (inherited by vectors)
+      if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+         def_append( array );
+
+      array
          // Size management
          .def( "setSize", &ArrayType::setSize, nb::arg( "size" ) )
          .def( "setLike", &ArrayType::template setLike< ArrayType > )
          .def( "resize", nb::overload_cast< IndexType >( &ArrayType::resize ), nb::arg( "size" ) )
          .def(
-            "resize", nb::overload_cast< IndexType, ValueType >( &ArrayType::resize ), nb::arg( "size" ), nb::arg( "value" ) )
+            "resize",
+            []( ArrayType& array, IndexType size, ValueType value )
+            {
+               pytnl::gil_release_for_size release( size );
+               array.resize( size, value );
+            },
+            nb::arg( "size" ),
+            nb::arg( "value" ) )
 
          // File I/O
          .def_static( "getSerializationType", &ArrayType::getSerializationType )
@@ -245,14 +366,19 @@ export_Array( nb::module_& m, const char* name )
             "__copy__",
             []( const ArrayType& self )
             {
+               if( pytnl::containers::use_copy_on_write( self ) )
+                  return pytnl::containers::shallow_copy( self );
+               pytnl::gil_release_for_size release( self.getSize() );
                return ArrayType( self );
             } )
          .def(
             "__deepcopy__",
             []( const ArrayType& self, nb::typed< nb::dict, nb::str, nb::any > )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return ArrayType( self );
             },
             nb::arg( "memo" ) );
+      def_pickle( array );
    }
 }
@@ -0,0 +1,803 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/parallelFor.h>
+#include <TNL/Algorithms/reduce.h>
+#include <TNL/Containers/ArrayView.h>
+#include <TNL/Devices/Host.h>
+#include <TNL/Functional.h>
+#include <TNL/Math.h>
+
+#include "StridedArrayView.h"
+#include "indexing.h"
+
+namespace pytnl::containers {
+
+/**
+ * \brief Array of booleans packed into 64-bit words (one bit per element).
+ *
+ * The bits past the end of the array are always zero, so `count`, `any`,
+ * `all` and the bitwise operators work on whole words without masking the
+ * last one. All operations are parallelized over the words, so an element
+ * is never written by two threads.
+ */
+class BitArray
+{
+public:
+   using WordType = std::uint64_t;
+   using IndexType = ::IndexType;
+   using WordArray = pytnl::Array< WordType, TNL::Devices::Host >;
+
+   static constexpr IndexType wordBits = 64;
+
+   BitArray() = default;
+
+   explicit BitArray( IndexType size, bool value = false )
+   {
+      setSize( size );
+      setValue( value );
+   }
+
+   [[nodiscard]] IndexType
+   getSize() const
+   {
+      return size;
+   }
+
+   [[nodiscard]] IndexType
+   getWordCount() const
+   {
+      return words.getSize();
+   }
+
+   //! \brief Changes the size of the array, all bits are cleared.
+   void
+   setSize( IndexType newSize )
+   {
+      if( newSize < 0 )
+         throw nb::value_error( "the size must be non-negative" );
+      size = newSize;
+      words.setSize( ( newSize + wordBits - 1 ) / wordBits );
+      words.setValue( 0 );
+   }
+
+   void
+   setValue( bool value )
+   {
+      words.setValue( value ? ~WordType{ 0 } : WordType{ 0 } );
+      clearTail();
+   }
+
+   [[nodiscard]] bool
+   getElement( IndexType i ) const
+   {
+      return ( words[ i / wordBits ] >> ( i % wordBits ) ) & 1;
+   }
+
+   void
+   setElement( IndexType i, bool value )
+   {
+      const WordType bit = WordType{ 1 } << ( i % wordBits );
+      if( value )
+         words[ i / wordBits ] |= bit;
+      else
+         words[ i / wordBits ] &= ~bit;
+   }
+
+   //! \brief Returns the number of set bits.
+   [[nodiscard]] IndexType
+   count() const
+   {
+      const WordType* w = words.getData();
+      auto fetch = [ = ]( IndexType i ) -> IndexType
+      {
+         return popcount( w[ i ] );
+      };
+      return TNL::Algorithms::reduce< TNL::Devices::Host >( IndexType{ 0 }, getWordCount(), fetch, TNL::Plus{} );
+   }
+
+   //! \brief Returns the number of bits set in both this array and `mask`.
+   [[nodiscard]] IndexType
+   count( const BitArray& mask ) const
+   {
+      const WordType* a = words.getData();
+      const WordType* b = mask.words.getData();
+      auto fetch = [ = ]( IndexType i ) -> IndexType
+      {
+         return popcount( a[ i ] & b[ i ] );
+      };
+      return TNL::Algorithms::reduce< TNL::Devices::Host >( IndexType{ 0 }, getWordCount(), fetch, TNL::Plus{} );
+   }
+
+   [[nodiscard]] bool
+   any() const
+   {
+      const WordType* w = words.getData();
+      auto fetch = [ = ]( IndexType i ) -> bool
+      {
+         return w[ i ] != 0;
+      };
+      return TNL::Algorithms::reduce< TNL::Devices::Host >( IndexType{ 0 }, getWordCount(), fetch, TNL::LogicalOr{} );
+   }
+
+   [[nodiscard]] bool
+   all() const
+   {
+      return count() == size;
+   }
+
+   BitArray&
+   operator&=( const BitArray& other )
+   {
+      apply( other,
+             []( WordType a, WordType b )
+             {
+                return a & b;
+             } );
+      return *this;
+   }
+
+   BitArray&
+   operator|=( const BitArray& other )
+   {
+      apply( other,
+             []( WordType a, WordType b )
+             {
+                return a | b;
+             } );
+      return *this;
+   }
+
+   BitArray&
+   operator^=( const BitArray& other )
+   {
+      apply( other,
+             []( WordType a, WordType b )
+             {
+                return a ^ b;
+             } );
+      return *this;
+   }
+
+   //! \brief Negates all bits.
+   void
+   flip()
+   {
+      WordType* w = words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             w[ i ] = ~w[ i ];
+                                                          } );
+      clearTail();
+   }
+
+   [[nodiscard]] bool
+   operator==( const BitArray& other ) const
+   {
+      return size == other.size && words == other.words;
+   }
+
+   [[nodiscard]] bool
+   operator!=( const BitArray& other ) const
+   {
+      return ! ( *this == other );
+   }
+
+   //! \brief Packs a view of booleans (or any values, non-zero values are set).
+   template< typename View >
+   void
+   pack( const View& view )
+   {
+      setSize( view.getSize() );
+      const auto* in = view.getData();
+      const IndexType n = size;
+      WordType* w = words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             const IndexType begin = i * wordBits;
+                                                             const IndexType end = TNL::min( begin + wordBits, n );
+                                                             WordType word = 0;
+                                                             for( IndexType j = begin; j < end; j++ )
+                                                                word |= WordType( in[ j ] != 0 ) << ( j - begin );
+                                                             w[ i ] = word;
+                                                          } );
+   }
+
+   //! \brief Unpacks the bits into a view of booleans, which must have the same size.
+   template< typename View >
+   void
+   unpack( const View& view ) const
+   {
+      auto* out = view.getData();
+      const IndexType n = size;
+      const WordType* w = words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             const IndexType begin = i * wordBits;
+                                                             const IndexType end = TNL::min( begin + wordBits, n );
+                                                             const WordType word = w[ i ];
+                                                             for( IndexType j = begin; j < end; j++ )
+                                                                out[ j ] = ( word >> ( j - begin ) ) & 1;
+                                                          } );
+   }
+
+   //! \brief Sets `value` to the elements of `view` whose bits are set.
+   template< typename View >
+   void
+   maskedSetValue( const View& view, typename View::ValueType value ) const
+   {
+      auto* out = view.getData();
+      const WordType* w = words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             // visit only the set bits, empty words are skipped at once
+                                                             for( WordType word = w[ i ]; word != 0; word &= word - 1 )
+                                                                out[ i * wordBits + countTrailingZeros( word ) ] = value;
+                                                          } );
+   }
+
+   //! \brief Returns the sum of the elements of `view` whose bits are set (16-bit values are summed in float).
+   template< typename View >
+   [[nodiscard]] pytnl::compute_type_t< std::remove_const_t< typename View::ValueType > >
+   maskedSum( const View& view ) const
+   {
+      using Value = pytnl::compute_type_t< std::remove_const_t< typename View::ValueType > >;
+      const auto* in = view.getData();
+      const WordType* w = words.getData();
+      auto fetch = [ = ]( IndexType i ) -> Value
+      {
+         Value result = 0;
+         for( WordType word = w[ i ]; word != 0; word &= word - 1 )
+            result += in[ i * wordBits + countTrailingZeros( word ) ];
+         return result;
+      };
+      return TNL::Algorithms::reduce< TNL::Devices::Host >( IndexType{ 0 }, getWordCount(), fetch, TNL::Plus{} );
+   }
+
+   /**
+    * \brief Returns the elements `begin, begin + step, ...` (`length` elements)
+    * as a new array. Contiguous ranges are copied word-wise.
+    */
+   [[nodiscard]] BitArray
+   getSlice( IndexType begin, IndexType step, IndexType length ) const
+   {
+      BitArray result( length );
+      const WordType* in = words.getData();
+      const IndexType inWords = getWordCount();
+      WordType* out = result.words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          result.getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             if( step == 1 ) {
+                                                                out[ i ] = extractWord( in, inWords, begin + i * wordBits );
+                                                                return;
+                                                             }
+                                                             const IndexType end = TNL::min( ( i + 1 ) * wordBits, length );
+                                                             WordType word = 0;
+                                                             for( IndexType j = i * wordBits; j < end; j++ ) {
+                                                                const IndexType k = begin + j * step;
+                                                                word |= ( ( in[ k / wordBits ] >> ( k % wordBits ) ) & 1 )
+                                                                     << ( j % wordBits );
+                                                             }
+                                                             out[ i ] = word;
+                                                          } );
+      result.clearTail();
+      return result;
+   }
+
+   /**
+    * \brief Assigns `value` to the elements `begin, begin + step, ...` (the
+    * size of `value` elements). Contiguous ranges are assigned word-wise,
+    * other slices element by element.
+    */
+   void
+   setSlice( IndexType begin, IndexType step, const BitArray& value )
+   {
+      if( &value == this ) {
+         const BitArray copy( value );
+         setSlice( begin, step, copy );
+         return;
+      }
+      const IndexType length = value.getSize();
+      if( step != 1 ) {
+         // elements of different words of `value` may fall into the same word
+         for( IndexType j = 0; j < length; j++ )
+            setElement( begin + j * step, value.getElement( j ) );
+         return;
+      }
+      if( length == 0 )
+         return;
+      const WordType* in = value.words.getData();
+      const IndexType inWords = value.getWordCount();
+      updateWords( begin,
+                   begin + length,
+                   [ = ]( IndexType first )
+                   {
+                      return extractWord( in, inWords, first - begin );
+                   } );
+   }
+
+   //! \brief Sets the elements `begin, begin + step, ...` (`length` elements) to `value`.
+   void
+   setSliceValue( IndexType begin, IndexType step, IndexType length, bool value )
+   {
+      if( step != 1 ) {
+         for( IndexType j = 0; j < length; j++ )
+            setElement( begin + j * step, value );
+         return;
+      }
+      if( length == 0 )
+         return;
+      const WordType fill = value ? ~WordType{ 0 } : WordType{ 0 };
+      updateWords( begin,
+                   begin + length,
+                   [ = ]( IndexType )
+                   {
+                      return fill;
+                   } );
+   }
+
+   [[nodiscard]] const WordArray&
+   getWords() const
+   {
+      return words;
+   }
+
+   [[nodiscard]] WordArray&
+   getWords()
+   {
+      return words;
+   }
+
+   void
+   clearTail()
+   {
+      if( size % wordBits != 0 )
+         words[ getWordCount() - 1 ] &= ( WordType{ 1 } << ( size % wordBits ) ) - 1;
+   }
+
+private:
+   static IndexType
+   popcount( WordType word )
+   {
+      // std::popcount is C++20, std::bitset::count compiles to the popcnt instruction
+      return static_cast< IndexType >( std::bitset< wordBits >( word ).count() );
+   }
+
+   static IndexType
+   countTrailingZeros( WordType word )
+   {
+      return __builtin_ctzll( word );
+   }
+
+   //! \brief Returns the 64 bits starting at the bit `first` of the words `w` (the bits past the end are zero).
+   static WordType
+   extractWord( const WordType* w, IndexType wordCount, IndexType first )
+   {
+      const IndexType word = first / wordBits;
+      const IndexType shift = first % wordBits;
+      WordType result = w[ word ] >> shift;
+      if( shift != 0 && word + 1 < wordCount )
+         result |= w[ word + 1 ] << ( wordBits - shift );
+      return result;
+   }
+
+   /**
+    * \brief Replaces the bits `[begin, end)` word by word: the bits of the word
+    * starting at the bit `first` are taken from `source( first )`. Each word
+    * is updated by one thread.
+    */
+   template< typename Source >
+   void
+   updateWords( IndexType begin, IndexType end, Source source )
+   {
+      WordType* w = words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( begin / wordBits,
+                                                          ( end - 1 ) / wordBits + 1,
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             const IndexType lo = TNL::max( i * wordBits, begin );
+                                                             const IndexType hi = TNL::min( ( i + 1 ) * wordBits, end );
+                                                             const IndexType shift = lo - i * wordBits;
+                                                             const WordType ones = hi - lo == wordBits
+                                                                                    ? ~WordType{ 0 }
+                                                                                    : ( WordType{ 1 } << ( hi - lo ) ) - 1;
+                                                             const WordType mask = ones << shift;
+                                                             w[ i ] = ( w[ i ] & ~mask ) | ( ( source( lo ) << shift ) & mask );
+                                                          } );
+   }
+
+   template< typename Operation >
+   void
+   apply( const BitArray& other, Operation operation )
+   {
+      if( other.size != size )
+         throw nb::value_error( ( "the bit arrays have different sizes: " + std::to_string( size ) + " and "
+                                  + std::to_string( other.size ) )
+                                   .c_str() );
+      WordType* a = words.getData();
+      const WordType* b = other.words.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                          getWordCount(),
+                                                          [ = ]( IndexType i ) mutable
+                                                          {
+                                                             a[ i ] = operation( a[ i ], b[ i ] );
+                                                          } );
+   }
+
+   WordArray words;
+   IndexType size = 0;
+};
+
+//! \brief Checks that a mask has the same size as the masked array.
+template< typename Index >
+void
+check_mask_size( Index size, const BitArray& mask )
+{
+   if( mask.getSize() != size )
+      throw nb::value_error( ( "the mask has size " + std::to_string( mask.getSize() ) + ", expected "
+                               + std::to_string( size ) )
+                                .c_str() );
+}
+
+}  // namespace pytnl::containers
+
+/* Bit-packed boolean array on the host. It takes 1/8 of the memory of
+ * Array_bool and the reductions and bitwise operators process 64 elements
+ * at once. Arrays and vectors on the host accept it as a mask in `setValue`
+ * and `sum`, see def_masked_operations. Slicing follows Array_bool, except
+ * that the slices are copies rather than views.
+ */
+inline void
+export_BitArray( nb::module_& m, const char* name )
+{
+   using BitArray = pytnl::containers::BitArray;
+   using IndexType = BitArray::IndexType;
+   using BoolView = TNL::Containers::ArrayView< bool, TNL::Devices::Host, IndexType >;
+   using BoolConstView = TNL::Containers::ArrayView< const bool, TNL::Devices::Host, IndexType >;
+   using BoolArray = pytnl::Array< bool, TNL::Devices::Host >;
+
+   auto bits = nb::class_< BitArray >( m, name, "Array of booleans packed into 64-bit words." );
+   bits  //
+      .def( nb::init<>() )
+      .def(
+         "__init__",
+         []( BitArray* self, IndexType size, bool value )
+         {
+            if( size < 0 )
+               throw nb::value_error( "the size must be non-negative" );
+            pytnl::gil_release_for_size release( size );
+            new( self ) BitArray( size, value );
+         },
+         nb::arg( "size" ),
+         nb::arg( "value" ) = false )
+      .def(
+         "__init__",
+         []( BitArray* self, BoolConstView array )
+         {
+            new( self ) BitArray;
+            pytnl::gil_release_for_size release( array.getSize() );
+            self->pack( array );
+         },
+         nb::arg( "array" ),
+         "Packs an array of booleans (`Array_bool` or a compatible view)." )
+      .def( "getSize", &BitArray::getSize )
+      .def( "__len__", &BitArray::getSize )
+      .def( "getWordCount", &BitArray::getWordCount, "Returns the number of 64-bit words used for the storage." )
+      .def( "setSize", &BitArray::setSize, nb::arg( "size" ), "Changes the size of the array, all bits are cleared." )
+      .def(
+         "setValue",
+         []( BitArray& self, bool value )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            self.setValue( value );
+         },
+         nb::arg( "value" ) )
+      .def(
+         "__getitem__",
+         []( const BitArray& self, IndexType i )
+         {
+            if( i < 0 )
+               i += self.getSize();
+            check_array_index( self.getSize(), i );
+            return self.getElement( i );
+         },
+         nb::arg( "i" ) )
+      .def(
+         "__setitem__",
+         []( BitArray& self, IndexType i, bool value )
+         {
+            if( i < 0 )
+               i += self.getSize();
+            check_array_index( self.getSize(), i );
+            self.setElement( i, value );
+         },
+         nb::arg( "i" ),
+         nb::arg( "value" ) )
+      .def(
+         "__getitem__",
+         []( const BitArray& self, nb::slice slice )
+         {
+            auto [ start, stop, step, slicelength ] = slice.compute( self.getSize() );
+            const auto length = static_cast< IndexType >( slicelength );
+            pytnl::gil_release_for_size release( length );
+            return self.getSlice( start, step, length );
+         },
+         "Returns the elements selected by a slice object as a new bit array.\n\n"
+         "Unlike the slices of `Array_bool`, the result is a copy, since single bits cannot be referenced by a view. "
+         "Slices with step 1 are copied word-wise." )
+      .def(
+         "__setitem__",
+         []( BitArray& self, nb::slice slice, const BitArray& value )
+         {
+            auto [ start, stop, step, slicelength ] = slice.compute( self.getSize() );
+            check_slice_assignment_size( slicelength, value.getSize() );
+            pytnl::gil_release_for_size release( value.getSize() );
+            self.setSlice( start, step, value );
+         },
+         "Assigns a bit array to the elements selected by a slice object (word-wise for slices with step 1)." )
+      .def(
+         "__setitem__",
+         []( BitArray& self, nb::slice slice, BoolConstView value )
+         {
+            auto [ start, stop, step, slicelength ] = slice.compute( self.getSize() );
+            check_slice_assignment_size( slicelength, value.getSize() );
+            pytnl::gil_release_for_size release( value.getSize() );
+            BitArray packed;
+            packed.pack( value );
+            self.setSlice( start, step, packed );
+         },
+         "Assigns an array of booleans to the elements selected by a slice object." )
+      .def(
+         "__setitem__",
+         []( BitArray& self, nb::slice slice, bool value )
+         {
+            auto [ start, stop, step, slicelength ] = slice.compute( self.getSize() );
+            const auto length = static_cast< IndexType >( slicelength );
+            pytnl::gil_release_for_size release( length );
+            self.setSliceValue( start, step, length, value );
+         },
+         "Sets the elements selected by a slice object to a value." )
+
+      // Reductions
+      .def(
+         "count",
+         []( const BitArray& self )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self.count();
+         },
+         "Returns the number of set bits." )
+      .def(
+         "count",
+         []( const BitArray& self, const BitArray& mask )
+         {
+            pytnl::containers::check_mask_size( self.getSize(), mask );
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self.count( mask );
+         },
+         nb::arg( "mask" ),
+         "Returns the number of bits set in both `self` and `mask` (without computing `self & mask`)." )
+      .def(
+         "any",
+         []( const BitArray& self )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self.any();
+         } )
+      .def(
+         "all",
+         []( const BitArray& self )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self.all();
+         } )
+
+      // Bitwise operators
+      .def(
+         "__iand__",
+         []( BitArray& self, const BitArray& other ) -> BitArray&
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self &= other;
+         },
+         nb::is_operator() )
+      .def(
+         "__ior__",
+         []( BitArray& self, const BitArray& other ) -> BitArray&
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self |= other;
+         },
+         nb::is_operator() )
+      .def(
+         "__ixor__",
+         []( BitArray& self, const BitArray& other ) -> BitArray&
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            return self ^= other;
+         },
+         nb::is_operator() )
+      .def(
+         "__and__",
+         []( const BitArray& self, const BitArray& other )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            BitArray result( self );
+            result &= other;
+            return result;
+         },
+         nb::is_operator() )
+      .def(
+         "__or__",
+         []( const BitArray& self, const BitArray& other )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            BitArray result( self );
+            result |= other;
+            return result;
+         },
+         nb::is_operator() )
+      .def(
+         "__xor__",
+         []( const BitArray& self, const BitArray& other )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            BitArray result( self );
+            result ^= other;
+            return result;
+         },
+         nb::is_operator() )
+      .def( "__invert__",
+            []( const BitArray& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               BitArray result( self );
+               result.flip();
+               return result;
+            } )
+      .def(
+         "flip",
+         []( BitArray& self )
+         {
+            pytnl::gil_release_for_size release( self.getSize() );
+            self.flip();
+         },
+         "Negates all bits in place." )
+      .def(
+         "__eq__",
+         []( const BitArray& self, const BitArray& other )
+         {
+            return self == other;
+         },
+         nb::sig( "def __eq__(self, arg: object, /) -> bool" ),
+         nb::is_operator() )
+      .def(
+         "__ne__",
+         []( const BitArray& self, const BitArray& other )
+         {
+            return self != other;
+         },
+         nb::sig( "def __ne__(self, arg: object, /) -> bool" ),
+         nb::is_operator() )
+
+      // Conversions
+      .def(
+         "toArray",
+         []( const BitArray& self )
+         {
+            BoolArray result( self.getSize() );
+            pytnl::gil_release_for_size release( self.getSize() );
+            self.unpack( result.getView() );
+            return result;
+         },
+         "Returns the bits unpacked into an `Array_bool`." )
+      .def(
+         "unpack",
+         []( const BitArray& self, BoolView out )
+         {
+            if( out.getSize() != self.getSize() )
+               throw nb::value_error( "the output array must have the same size as the bit array" );
+            pytnl::gil_release_for_size release( self.getSize() );
+            self.unpack( out );
+         },
+         nb::arg( "out" ),
+         "Unpacks the bits into an existing array of booleans." )
+      .def(
+         "getWords",
+         []( nb::pointer_and_handle< BitArray > self )
+         {
+            // read-only, writing into the words could break the zero tail which the reductions rely on
+            using WordsView = nb::ndarray< nb::numpy, const BitArray::WordType, nb::ndim< 1 > >;
+            const auto& words = self.p->getWords();
+            return WordsView( words.getData(), { static_cast< std::size_t >( words.getSize() ) }, self.h );
+         },
+         "Returns a read-only NumPy view of the 64-bit words storing the bits (the bits past the size are zero).\n\n"
+         "The view is invalidated by `setSize`." )
+      .def( "__str__",
+            []( const BitArray& self )
+            {
+               std::stringstream ss;
+               ss << "[";
+               for( IndexType i = 0; i < self.getSize(); i++ )
+                  ss << ( i > 0 ? ", " : "" ) << ( self.getElement( i ) ? 1 : 0 );
+               ss << "]";
+               return ss.str();
+            } )
+      .def( "__copy__",
+            []( const BitArray& self )
+            {
+               return BitArray( self );
+            } )
+      .def(
+         "__deepcopy__",
+         []( const BitArray& self, nb::typed< nb::dict, nb::str, nb::any > )
+         {
+            return BitArray( self );
+         },
+         nb::arg( "memo" ) );
+}
+
+/* Masked operations of host arrays and vectors, evaluated directly on the
+ * packed mask (elements in unset 64-bit words are skipped at once).
+ */
+template< typename ArrayType, typename... Args >
+void
+def_masked_operations( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using BitArray = pytnl::containers::BitArray;
+
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      array.def(
+         "setValue",
+         []( ArrayType& self, ValueType value, const BitArray& mask )
+         {
+            pytnl::containers::check_mask_size( self.getSize(), mask );
+            pytnl::containers::detach( self );
+            pytnl::gil_release_for_size release( self.getSize() );
+            mask.maskedSetValue( self.getView(), value );
+         },
+         nb::arg( "value" ),
+         nb::arg( "mask" ),
+         "Sets `value` to the elements whose bits are set in `mask`." );
+   }
+}
+
+template< typename VectorType, typename... Args >
+void
+def_masked_reductions( nb::class_< VectorType, Args... >& vector )
+{
+   using RealType = std::remove_const_t< typename VectorType::RealType >;
+   using BitArray = pytnl::containers::BitArray;
+
+   if constexpr( TNL::IsScalarType< RealType >::value ) {
+      vector.def(
+         "sum",
+         []( const VectorType& self, const BitArray& mask )
+         {
+            pytnl::containers::check_mask_size( self.getSize(), mask );
+            pytnl::gil_release_for_size release( self.getSize() );
+            return mask.maskedSum( self.getConstView() );
+         },
+         nb::arg( "mask" ),
+         "Returns the sum of the elements whose bits are set in `mask`." );
+   }
+}
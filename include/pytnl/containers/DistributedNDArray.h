@@ -1,5 +1,6 @@
 #pragma once
 
+#include <pytnl/gil.h>
 #include <pytnl/pytnl.h>
 
 #include <TNL/Containers/DistributedNDArray.h>
@@ -186,13 +187,31 @@ export_DistributedNDArray( nb::module_& m, const char* name )
                {
                   if constexpr( std::is_const_v< ValueType > )
                      throw nb::type_error( "Cannot assign into constant array" );
-                  else
+                  else {
+                     pytnl::gil_release_for_size release( other.getLocalStorageSize() );
                      return array = other;
+                  }
                } )
 
          // Comparison
-         .def( nb::self == nb::self, nb::sig( "def __eq__(self, arg: object, /) -> bool" ) )
-         .def( nb::self != nb::self, nb::sig( "def __ne__(self, arg: object, /) -> bool" ) )
+         .def(
+            "__eq__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getLocalStorageSize() );
+               return self == other;
+            },
+            nb::sig( "def __eq__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
+         .def(
+            "__ne__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getLocalStorageSize() );
+               return self != other;
+            },
+            nb::sig( "def __ne__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
 
          // String representation
          .def(
@@ -394,19 +413,28 @@ export_DistributedNDArray( nb::module_& m, const char* name )
          .def( "allocate", &ArrayType::allocate )
 
          // Fill
-         .def( "setValue", &ArrayType::setValue, nb::arg( "value" ) )
+         .def(
+            "setValue",
+            []( ArrayType& self, typename ArrayType::ValueType value )
+            {
+               pytnl::gil_release_for_size release( self.getLocalStorageSize() );
+               self.setValue( value );
+            },
+            nb::arg( "value" ) )
 
          // Deepcopy support https://pybind11.readthedocs.io/en/stable/advanced/classes.html#deepcopy-support
          .def(
             "__copy__",
             []( const ArrayType& self )
             {
+               pytnl::gil_release_for_size release( self.getLocalStorageSize() );
                return ArrayType( self );
             } )
          .def(
             "__deepcopy__",
             []( const ArrayType& self, nb::typed< nb::dict, nb::str, nb::any > )
             {
+               pytnl::gil_release_for_size release( self.getLocalStorageSize() );
                return ArrayType( self );
             },
             nb::arg( "memo" ) );
@@ -2,6 +2,7 @@
 
 #include <array>
 
+#include <pytnl/gil.h>
 #include <pytnl/pytnl.h>
 
 #include <TNL/Containers/NDArray.h>
@@ -9,7 +10,12 @@
 #include <TNL/Allocators/CudaManaged.h>
 
 #include "dlpack.h"
+#include "external_views.h"
+#include "pickle.h"
 #include "buffer_protocol.h"
+#include "compression.h"
+#include "copy_on_write.h"
+#include "random.h"
 
 template< typename Index >
 void
@@ -104,6 +110,7 @@ ndarray_indexing( nb::class_< ArrayType, Args... >& array )
                {
                   // setElement is equivalent to operator[] on host but works on cuda
                   const auto idx = self.getStorageIndex( indices... );
+                  pytnl::containers::detach( self );
                   self.getStorageArrayView().setElement( idx, value );
                },
                indices_array );
@@ -322,7 +329,7 @@ export_NDArray( nb::module_& m, const char* name )
                else if constexpr( std::is_integral_v< ValueType > ) {
                   return nb::borrow( &PyLong_Type );
                }
-               else if constexpr( std::is_floating_point_v< ValueType > ) {
+               else if constexpr( std::is_floating_point_v< ValueType > || pytnl::is_half_v< ValueType > ) {
                   return nb::borrow( &PyFloat_Type );
                }
                else if constexpr( TNL::is_complex_v< ValueType > ) {
@@ -347,16 +354,32 @@ export_NDArray( nb::module_& m, const char* name )
 
          // Constructors
          .def( nb::init<>() )
-         .def( nb::init< ArrayType >(), nb::arg( "other" ) )
+         .def(
+            "__init__",
+            []( ArrayType* self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( other.getStorageSize() );
+               new( self ) ArrayType( other );
+            },
+            nb::arg( "other" ) )
 
          // NDArrayView getters
-         .def( "getView", &ArrayType::getView )
+         .def( "getView",
+               []( ArrayType& self )
+               {
+                  pytnl::containers::detach_for_export( self );
+                  return self.getView();
+               } )
          .def( "getConstView", &ArrayType::getConstView )
          // TODO: getSubarrayView (requires template parameters...)
 
          // Internal storage
          .def( "getStorageArrayView",
-               &ArrayType::getStorageArrayView,
+               []( ArrayType& self )
+               {
+                  pytnl::containers::detach_for_export( self );
+                  return self.getStorageArrayView();
+               },
                nb::rv_policy::reference_internal,
                "Return an ArrayView for the underlying storage array." )
 
@@ -366,13 +389,32 @@ export_NDArray( nb::module_& m, const char* name )
                {
                   if constexpr( std::is_const_v< ValueType > )
                      throw nb::type_error( "Cannot assign into constant array" );
-                  else
+                  else {
+                     pytnl::containers::detach( array );
+                     pytnl::gil_release_for_size release( other.getStorageSize() );
                      return array = other;
+                  }
                } )
 
          // Comparison
-         .def( nb::self == nb::self, nb::sig( "def __eq__(self, arg: object, /) -> bool" ) )
-         .def( nb::self != nb::self, nb::sig( "def __ne__(self, arg: object, /) -> bool" ) )
+         .def(
+            "__eq__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getStorageSize() );
+               return self == other;
+            },
+            nb::sig( "def __eq__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
+         .def(
+            "__ne__",
+            []( const ArrayType& self, const ArrayType& other )
+            {
+               pytnl::gil_release_for_size release( self.getStorageSize() );
+               return self != other;
+            },
+            nb::sig( "def __ne__(self, arg: object, /) -> bool" ),
+            nb::is_operator() )
 
          // String representation
          .def(
@@ -388,7 +430,7 @@ export_NDArray( nb::module_& m, const char* name )
                else if constexpr( std::is_integral_v< ValueType > ) {
                   oss << "int";
                }
-               else if constexpr( std::is_floating_point_v< ValueType > ) {
+               else if constexpr( std::is_floating_point_v< ValueType > || pytnl::is_half_v< ValueType > ) {
                   oss << "float";
                }
                else if constexpr( TNL::is_complex_v< ValueType > ) {
@@ -429,6 +471,8 @@ export_NDArray( nb::module_& m, const char* name )
                // FIXME: DLPack support switching CUDA devices but TNL does not
                if constexpr( std::is_same_v< DeviceType, TNL::Devices::Cuda > )
                   device_id = TNL::Backend::getDevice();
+               // the consumer may write into the data
+               pytnl::containers::detach_for_export( *self.p );
 
                constexpr std::size_t dim = ArrayType::getDimension();
                std::array< std::size_t, dim > sizes;
@@ -461,6 +505,18 @@ export_NDArray( nb::module_& m, const char* name )
 
    ndarray_indexing( array );
    ndarray_iteration( array );
+   def_ndarray_compressed_serialization( array );
+
+   // random fills in the order of the storage
+   if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > && ! std::is_const_v< ValueType >
+                 && std::is_floating_point_v< pytnl::compute_type_t< ValueType > > )
+   {
+      def_random_fill( array,
+                       []( ArrayType& self )
+                       {
+                          return self.getStorageArrayView();
+                       } );
+   }
 
    if constexpr( TNL::IsViewType< ArrayType >::value ) {
       array  //
@@ -479,6 +535,7 @@ export_NDArray( nb::module_& m, const char* name )
             "Reset the array view to the empty state. There is no deallocation, it does not affect other views." )
          //
          ;
+      def_external_ndarray_view_constructor< ArrayType >( array );
    }
    else {
       // Additional NDArray-specific methods
@@ -529,23 +586,36 @@ export_NDArray( nb::module_& m, const char* name )
             "thus all pointers and views to the array elements will become invalid." )
 
          // Fill
-         .def( "setValue", &ArrayType::setValue, nb::arg( "value" ) )
+         .def(
+            "setValue",
+            []( ArrayType& self, typename ArrayType::ValueType value )
+            {
+               pytnl::containers::detach( self );
+               pytnl::gil_release_for_size release( self.getStorageSize() );
+               self.setValue( value );
+            },
+            nb::arg( "value" ) )
 
          // Deepcopy support https://pybind11.readthedocs.io/en/stable/advanced/classes.html#deepcopy-support
          .def(
             "__copy__",
             []( const ArrayType& self )
             {
+               if( pytnl::containers::use_copy_on_write( self ) )
+                  return pytnl::containers::shallow_copy( self );
+               pytnl::gil_release_for_size release( self.getStorageSize() );
                return ArrayType( self );
             } )
          .def(
             "__deepcopy__",
             []( const ArrayType& self, nb::typed< nb::dict, nb::str, nb::any > )
             {
+               pytnl::gil_release_for_size release( self.getStorageSize() );
                return ArrayType( self );
             },
             nb::arg( "memo" ) );
       //
       ;
+      def_ndarray_pickle( array );
    }
 }
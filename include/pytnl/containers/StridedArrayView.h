@@ -0,0 +1,372 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/parallelFor.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/ArrayView.h>
+
+#include "buffer_protocol.h"
+#include "indexing.h"
+
+namespace pytnl::containers {
+
+/**
+ * \brief Non-owning view of every `stride`-th element of an array.
+ *
+ * TNL does not have a strided counterpart of \ref TNL::Containers::ArrayView,
+ * so this class is used for Python slices with a step other than 1. The
+ * stride may be negative, in which case the elements are traversed
+ * backwards from `data`.
+ */
+template< typename Value, typename Device, typename Index >
+class StridedArrayView
+{
+public:
+   using ValueType = Value;
+   using DeviceType = Device;
+   using IndexType = Index;
+   using ConstViewType = StridedArrayView< std::add_const_t< Value >, Device, Index >;
+   using ContiguousViewType = TNL::Containers::ArrayView< Value, Device, Index >;
+
+   StridedArrayView() = default;
+
+   StridedArrayView( Value* data, Index size, Index stride )
+   : data( data ),
+     size( size ),
+     stride( stride )
+   {}
+
+   // conversion of a non-const view to a const view
+   template< typename Value_, std::enable_if_t< std::is_same_v< std::add_const_t< Value_ >, Value >, bool > = true >
+   StridedArrayView( const StridedArrayView< Value_, Device, Index >& view )
+   : data( view.getData() ),
+     size( view.getSize() ),
+     stride( view.getStride() )
+   {}
+
+   // a contiguous view is a strided view with stride 1
+   template< typename Value_, std::enable_if_t< std::is_same_v< std::add_const_t< Value_ >, Value >, bool > = true >
+   StridedArrayView( const TNL::Containers::ArrayView< Value_, Device, Index >& view )
+   : data( view.getData() ),
+     size( view.getSize() ),
+     stride( 1 )
+   {}
+
+   [[nodiscard]] Value*
+   getData() const
+   {
+      return data;
+   }
+
+   [[nodiscard]] Index
+   getSize() const
+   {
+      return size;
+   }
+
+   [[nodiscard]] Index
+   getStride() const
+   {
+      return stride;
+   }
+
+   [[nodiscard]] std::remove_const_t< Value >
+   getElement( Index i ) const
+   {
+      return ContiguousViewType( data + i * stride, 1 ).getElement( 0 );
+   }
+
+   void
+   setElement( Index i, const std::remove_const_t< Value >& value ) const
+   {
+      ContiguousViewType( data + i * stride, 1 ).setElement( 0, value );
+   }
+
+   //! \brief Returns a view of the elements `start, start + step, ...` of this view.
+   [[nodiscard]] StridedArrayView
+   getSlice( Index start, Index step, Index length ) const
+   {
+      if( length == 0 )
+         return StridedArrayView( data, 0, stride * step );
+      return StridedArrayView( data + start * stride, length, stride * step );
+   }
+
+   void
+   setValue( const std::remove_const_t< Value >& value ) const
+   {
+      Value* d = data;
+      const Index s = stride;
+      TNL::Algorithms::parallelFor< Device >( Index{ 0 },
+                                              size,
+                                              [ = ] __cuda_callable__( Index i ) mutable
+                                              {
+                                                 d[ i * s ] = value;
+                                              } );
+   }
+
+   //! \brief Gathers the elements of the view into a contiguous array.
+   template< typename Array >
+   void
+   copyTo( Array& array ) const
+   {
+      array.setSize( size );
+      auto* out = array.getData();
+      const Value* in = data;
+      const Index s = stride;
+      TNL::Algorithms::parallelFor< Device >( Index{ 0 },
+                                              size,
+                                              [ = ] __cuda_callable__( Index i ) mutable
+                                              {
+                                                 out[ i ] = in[ i * s ];
+                                              } );
+   }
+
+   //! \brief Scatters the elements of another (strided) view into this view.
+   template< typename Value_ >
+   void
+   assign( const StridedArrayView< Value_, Device, Index >& other ) const
+   {
+      Value* out = data;
+      const Value_* in = other.getData();
+      const Index s_out = stride;
+      const Index s_in = other.getStride();
+      TNL::Algorithms::parallelFor< Device >( Index{ 0 },
+                                              size,
+                                              [ = ] __cuda_callable__( Index i ) mutable
+                                              {
+                                                 out[ i * s_out ] = in[ i * s_in ];
+                                              } );
+   }
+
+private:
+   Value* data = nullptr;
+   Index size = 0;
+   Index stride = 1;
+};
+
+//! \brief Checks if any element of `view` lies in the memory range `[begin, end)`.
+template< typename Value, typename Device, typename Index, typename T >
+bool
+overlaps( const StridedArrayView< Value, Device, Index >& view, const T* begin, const T* end )
+{
+   if( view.getSize() == 0 || begin == end )
+      return false;
+   const auto first = reinterpret_cast< std::uintptr_t >( view.getData() );
+   const auto last = reinterpret_cast< std::uintptr_t >( view.getData() + ( view.getSize() - 1 ) * view.getStride() );
+   const auto low = std::min( first, last );
+   const auto high = std::max( first, last ) + sizeof( Value );
+   return low < reinterpret_cast< std::uintptr_t >( end ) && reinterpret_cast< std::uintptr_t >( begin ) < high;
+}
+
+/**
+ * \brief Assigns `value` to the elements `start, start + step, ...` of `array`.
+ *
+ * When the source overlaps the memory of `array` (e.g. `a[1:] = a[:-1]`), it
+ * is copied into a temporary array first, so that the result does not
+ * depend on the order in which the elements are copied.
+ */
+template< typename Array, typename Value >
+void
+assign_slice( Array& array,
+              typename Array::IndexType start,
+              typename Array::IndexType step,
+              typename Array::IndexType length,
+              const StridedArrayView< Value, typename Array::DeviceType, typename Array::IndexType >& value )
+{
+   using ValueType = std::remove_const_t< typename Array::ValueType >;
+   using DeviceType = typename Array::DeviceType;
+   using IndexType = typename Array::IndexType;
+   using StridedViewType = StridedArrayView< ValueType, DeviceType, IndexType >;
+   using StridedConstViewType = typename StridedViewType::ConstViewType;
+
+   const auto target = StridedViewType( array.getData(), array.getSize(), 1 ).getSlice( start, step, length );
+   if( ! overlaps( value, array.getData(), array.getData() + array.getSize() ) ) {
+      // contiguous slices are assigned by one bulk copy
+      if( step == 1 && value.getStride() == 1 )
+         TNL::Containers::ArrayView< ValueType, DeviceType, IndexType >( target.getData(), length ) =
+            TNL::Containers::ArrayView< std::add_const_t< ValueType >, DeviceType, IndexType >( value.getData(), length );
+      else
+         target.assign( value );
+      return;
+   }
+   // the assignment a[:] = a would copy the memory onto itself
+   if( value.getData() == target.getData() && value.getStride() == target.getStride() )
+      return;
+   pytnl::Array< ValueType, DeviceType, IndexType > tmp;
+   value.copyTo( tmp );
+   target.assign( StridedConstViewType( tmp.getConstView() ) );
+}
+
+}  // namespace pytnl::containers
+
+template< typename Index >
+void
+check_slice_assignment_size( std::size_t slicelength, Index size )
+{
+   if( slicelength != static_cast< std::size_t >( size ) )
+      throw nb::value_error( ( "cannot assign an array of size " + std::to_string( size ) + " to a slice of length "
+                               + std::to_string( slicelength ) )
+                                .c_str() );
+}
+
+/* Slicing protocol for arrays and vectors (including views). Slices with step
+ * 1 are returned as contiguous views (ViewType), other slices are returned as
+ * StridedArrayView. In both cases the slice refers to the memory of the sliced
+ * object, which is kept alive while the slice exists. Note that the slices are
+ * invalidated when the sliced array is resized.
+ */
+template< typename Array, typename Scope >
+void
+def_slice_indexing( Scope& scope )
+{
+   using ValueType = typename Array::ValueType;
+   using DeviceType = typename Array::DeviceType;
+   using IndexType = typename Array::IndexType;
+   using ViewType = typename Array::ViewType;
+   using ConstViewType = typename Array::ConstViewType;
+   using StridedViewType = pytnl::containers::StridedArrayView< ValueType, DeviceType, IndexType >;
+   using StridedConstViewType = typename StridedViewType::ConstViewType;
+
+   scope.def(
+      "__getitem__",
+      []( Array& a, nb::slice slice ) -> nb::object
+      {
+         auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
+         const auto length = static_cast< IndexType >( slicelength );
+         // the slice may be used to modify the data
+         pytnl::containers::detach_for_export( a );
+         // NOTE: getView( begin, end ) cannot be used, because end == 0 means the end of the array
+         if( step == 1 )
+            return nb::cast( ViewType( a.getData() + start, length ) );
+         return nb::cast( StridedViewType( a.getData(), a.getSize(), 1 ).getSlice( start, step, length ) );
+      },
+      nb::keep_alive< 0, 1 >(),
+      nb::sig( "def __getitem__(self, arg: slice, /) -> typing.Any" ),
+      "Returns a view of the elements selected by a slice object (without copying)." );
+
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      scope
+         .def(
+            "__setitem__",
+            []( Array& a, nb::slice slice, const ConstViewType& value )
+            {
+               auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
+               check_slice_assignment_size( slicelength, value.getSize() );
+               const auto length = static_cast< IndexType >( slicelength );
+               pytnl::containers::detach( a );
+               pytnl::gil_release_for_size release( length );
+               pytnl::containers::assign_slice( a, start, step, length, StridedConstViewType( value ) );
+            },
+            "Assigns an array to the elements selected by a slice object." )
+         .def(
+            "__setitem__",
+            []( Array& a, nb::slice slice, const StridedConstViewType& value )
+            {
+               auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
+               check_slice_assignment_size( slicelength, value.getSize() );
+               const auto length = static_cast< IndexType >( slicelength );
+               pytnl::containers::detach( a );
+               pytnl::gil_release_for_size release( length );
+               pytnl::containers::assign_slice( a, start, step, length, value );
+            },
+            "Assigns a strided array view to the elements selected by a slice object." )
+         .def(
+            "__setitem__",
+            []( Array& a, nb::slice slice, const std::remove_const_t< ValueType >& value )
+            {
+               auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
+               const auto length = static_cast< IndexType >( slicelength );
+               pytnl::containers::detach( a );
+               pytnl::gil_release_for_size release( length );
+               StridedViewType( a.getData(), a.getSize(), 1 ).getSlice( start, step, length ).setValue( value );
+            },
+            "Sets the elements selected by a slice object to a value." );
+   }
+   else {
+      scope.def(
+         "__setitem__",
+         []( Array&, nb::slice, nb::handle )
+         {
+            throw nb::type_error( "Cannot set elements of a read-only array" );
+         } );
+   }
+}
+
+template< typename Value, typename Device, typename Index = IndexType >
+void
+export_StridedArrayView( nb::module_& m, const char* name )
+{
+   using ViewType = pytnl::containers::StridedArrayView< Value, Device, Index >;
+   using ArrayType = pytnl::Array< std::remove_const_t< Value >, Device, Index >;
+
+   auto view =  //
+      nb::class_< ViewType >(
+         m, name, nb::type_slots( pytnl::containers::buffer_protocol::strided_array_buffer_slots< ViewType >() ) )
+         .def( "getSize", &ViewType::getSize )
+         .def( "getStride", &ViewType::getStride, "Returns the distance between consecutive elements of the view." )
+         .def( "__len__", &ViewType::getSize )
+         .def(
+            "__getitem__",
+            []( const ViewType& self, Index i )
+            {
+               check_array_index( self.getSize(), i );
+               return self.getElement( i );
+            } )
+         .def(
+            "__getitem__",
+            []( const ViewType& self, nb::slice slice )
+            {
+               auto [ start, stop, step, slicelength ] = slice.compute( self.getSize() );
+               return self.getSlice( start, step, static_cast< Index >( slicelength ) );
+            },
+            nb::keep_alive< 0, 1 >() )
+         .def(
+            "copy",
+            []( const ViewType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               ArrayType array;
+               self.copyTo( array );
+               return array;
+            },
+            "Returns a contiguous copy of the elements in the view." )
+         .def( "__repr__",
+               []( const ViewType& self )
+               {
+                  return "<" + std::string( nb::type_name( nb::type< ViewType >() ).c_str() ) + " of size "
+                       + std::to_string( self.getSize() ) + " with stride " + std::to_string( self.getStride() ) + ">";
+               } );
+
+   if constexpr( ! std::is_const_v< Value > ) {
+      view  //
+         .def(
+            "__setitem__",
+            []( const ViewType& self, Index i, const Value& value )
+            {
+               check_array_index( self.getSize(), i );
+               self.setElement( i, value );
+            } )
+         .def(
+            "setValue",
+            []( const ViewType& self, const Value& value )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               self.setValue( value );
+            },
+            nb::arg( "value" ) );
+   }
+   else {
+      // implicit conversions used for the right hand side of slice assignments
+      view  //
+         .def( nb::init_implicit< pytnl::containers::StridedArrayView< std::remove_const_t< Value >, Device, Index > >() )
+         .def( nb::init_implicit< TNL::Containers::ArrayView< std::remove_const_t< Value >, Device, Index > >() )
+         .def( nb::init_implicit< TNL::Containers::ArrayView< Value, Device, Index > >() );
+   }
+}
@@ -1,11 +1,20 @@
 #pragma once
 
+#include <pytnl/gil.h>
 #include <pytnl/pytnl.h>
 
 #include <TNL/Containers/Vector.h>
 
+#include "BitArray.h"
+#include "copy_on_write.h"
+#include "conversion.h"
+#include "external_views.h"
 #include "indexing.h"
+#include "mapped_file.h"
+#include "shared_memory.h"
+#include "StridedArrayView.h"
 #include "vector_operators.h"
+#include "vector_reductions.h"
 
 template< typename ArrayType, typename VectorType >
 void
@@ -33,7 +42,7 @@ export_Vector( nb::module_& m, const char* name )
                else if constexpr( std::is_integral_v< RealType > ) {
                   return nb::borrow( &PyLong_Type );
                }
-               else if constexpr( std::is_floating_point_v< RealType > ) {
+               else if constexpr( std::is_floating_point_v< RealType > || pytnl::is_half_v< RealType > ) {
                   return nb::borrow( &PyFloat_Type );
                }
                else if constexpr( TNL::is_complex_v< RealType > ) {
@@ -62,6 +71,7 @@ export_Vector( nb::module_& m, const char* name )
             []( VectorType& self, IndexType begin = 0, IndexType end = 0 )
             {
                check_array_range( self.getSize(), begin, end );
+               pytnl::containers::detach_for_export( self );
                return self.getView( begin, end );
             },
             nb::arg( "begin" ) = 0,
@@ -79,26 +89,50 @@ export_Vector( nb::module_& m, const char* name )
    // override so slice indexing can be used with vector operators
    def_indexing< VectorType >( vector );
 
+   // NOTE: results of the operators are new vectors even for views
+   def_vector_operators( vector );
+
+   // parallel reductions (also available for views)
+   def_vector_reductions( vector );
+   if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+      def_masked_reductions( vector );
+
+   // slices of vectors are vector views
+   def_slice_indexing< VectorType >( vector );
+
    if constexpr( TNL::IsViewType< VectorType >::value ) {
       vector  //
-         .def( nb::init< const VectorType& >() )
-         // FIXME: needed for implicit conversion from Vector, but AllocatorType is ignored
-         .def( nb::init_implicit< TNL::Containers::Vector< std::remove_const_t< RealType >, DeviceType, IndexType >& >() );
+         .def( nb::init< const VectorType& >() );
+      // FIXME: needed for implicit conversion from Vector, but AllocatorType is ignored
+      def_view_from_array< VectorType, pytnl::Vector< std::remove_const_t< RealType >, DeviceType, IndexType > >( vector );
+      if constexpr( std::is_const_v< RealType > ) {
+         // implicit conversion from the non-const view
+         vector.def( nb::init_implicit< TNL::Containers::VectorView< std::remove_const_t< RealType >, DeviceType, IndexType > >() );
+      }
+      def_external_view_constructor< VectorType >( vector );
+      if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+         def_mapped_file< VectorType >( vector );
+         def_shared_memory< VectorType >( vector );
+      }
    }
    else {
-      // TODO: vector operations currently create a new vector - not usable for views
-      def_vector_operators( vector );
-
-      // TODO: slicing should work for views too
-      def_slice_indexing< VectorType >( vector );
-
       // Additional Vector-specific methods
       vector
          // NOTE: the nb::init<...> does not work due to list-initialization and
          //       std::list_initializer constructor in ArrayType
          .def( my_init< IndexType >(), nb::arg( "size" ) )
-         .def( my_init< IndexType, RealType >(), nb::arg( "size" ), nb::arg( "value" ) )
+         .def(
+            "__init__",
+            []( VectorType* self, IndexType size, RealType value )
+            {
+               pytnl::gil_release_for_size release( size );
+               new( self ) VectorType( size, value );
+            },
+            nb::arg( "size" ),
+            nb::arg( "value" ) );
+      def_bulk_constructor< VectorType >( vector );
 
+      vector
          // Serialization
          .def_static( "getSerializationType", &VectorType::getSerializationType )
 
@@ -107,12 +141,16 @@ export_Vector( nb::module_& m, const char* name )
             "__copy__",
             []( const VectorType& self )
             {
+               if( pytnl::containers::use_copy_on_write( self ) )
+                  return pytnl::containers::shallow_copy( self );
+               pytnl::gil_release_for_size release( self.getSize() );
                return VectorType( self );
             } )
          .def(
             "__deepcopy__",
             []( const VectorType& self, nb::typed< nb::dict, nb::str, nb::any > )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return VectorType( self );
             },
             nb::arg( "memo" ) );
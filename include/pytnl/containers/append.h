@@ -0,0 +1,213 @@
+#pragma once
+
+#include <Python.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Devices/Host.h>
+
+#include "conversion.h"
+#include "copy_on_write.h"
+
+namespace pytnl::containers {
+
+//! \brief Returns the number of elements which fit into the allocation of `array` without reallocation.
+template< typename ArrayType >
+typename ArrayType::IndexType
+get_capacity( const ArrayType& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using IndexType = typename ArrayType::IndexType;
+
+   if( array.getData() == nullptr )
+      return 0;
+   const std::size_t bytes = static_cast< std::size_t >( array.getSize() ) * sizeof( ValueType );
+   return static_cast< IndexType >( pytnl::allocators::CachingPool::getInstance().getCapacity( array.getData(), bytes )
+                                    / sizeof( ValueType ) );
+}
+
+/**
+ * \brief Appends `count` elements to the end of `array`, they are written by
+ * `fill( pointer )`.
+ *
+ * When the capacity is not sufficient (or the data is shared with a
+ * copy-on-write copy), the elements are moved to a new allocation for
+ * `capacity` elements (at least twice the current capacity, so that a
+ * sequence of appends takes amortized constant time per element). `fill`
+ * is called before the old allocation is released, so it may read the
+ * elements of `array` itself.
+ */
+template< typename ArrayType, typename Fill >
+void
+append_elements( ArrayType& array, typename ArrayType::IndexType count, Fill&& fill, typename ArrayType::IndexType capacity = 0 )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using IndexType = typename ArrayType::IndexType;
+   using Allocator = typename ArrayType::AllocatorType;
+   using Access = ArrayStorageAccess< ArrayType >;
+   auto& pool = pytnl::allocators::CachingPool::getInstance();
+
+   const IndexType size = array.getSize();
+   const IndexType oldCapacity = get_capacity( array );
+   const bool shared = size > 0 && pool.isShared( array.getData() );
+   if( size + count <= oldCapacity && ! shared ) {
+      fill( array.getData() + size );
+      Access::sizeOf( array ) = size + count;
+      return;
+   }
+
+   // a shared block is copied with the same capacity if the elements fit
+   const IndexType grown = size + count <= oldCapacity ? oldCapacity : 2 * oldCapacity;
+   capacity = std::max( { capacity, size + count, grown } );
+   Allocator allocator;
+   ValueType* data = allocator.allocate( capacity );
+   try {
+      pool.setCapacity( data, static_cast< std::size_t >( capacity ) * sizeof( ValueType ) );
+      if( size > 0 )
+         std::memcpy( static_cast< void* >( data ), array.getData(), static_cast< std::size_t >( size ) * sizeof( ValueType ) );
+      fill( data + size );
+   }
+   catch( ... ) {
+      allocator.deallocate( data, capacity );
+      throw;
+   }
+   // releases the old allocation (or one owner of a shared block)
+   if( array.getData() != nullptr )
+      allocator.deallocate( array.getData(), size );
+   Access::dataOf( array ) = data;
+   Access::sizeOf( array ) = size + count;
+}
+
+//! \brief Makes sure that `capacity` elements fit into the allocation of `array` without reallocation.
+template< typename ArrayType >
+void
+reserve( ArrayType& array, typename ArrayType::IndexType capacity )
+{
+   if( capacity <= get_capacity( array ) )
+      return;
+   append_elements(
+      array,
+      0,
+      []( auto* ) {},
+      capacity );
+}
+
+}  // namespace pytnl::containers
+
+/* Growing host arrays and vectors: `append` and `extend` reserve the capacity
+ * geometrically, so that accumulating a stream of elements takes linear time
+ * overall. The capacity beyond the size of the array is recorded in the
+ * caching pool, which releases the whole allocation.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_append( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using IndexType = typename ArrayType::IndexType;
+   using ConstViewType = typename ArrayType::ConstViewType;
+
+   // the elements past the size are not constructed, which is fine only for trivial types
+   static_assert( std::is_trivially_copyable_v< ValueType > );
+   static_assert( pytnl::containers::has_caching_allocator< ArrayType >::value );
+
+   array
+      .def(
+         "reserve",
+         []( ArrayType& self, IndexType capacity )
+         {
+            if( capacity < 0 )
+               throw nb::value_error( ( "capacity must be non-negative, got " + std::to_string( capacity ) ).c_str() );
+            pytnl::gil_release_for_size release( self.getSize() );
+            pytnl::containers::reserve( self, capacity );
+         },
+         nb::arg( "capacity" ),
+         "Reallocates the array so that it can grow up to `capacity` elements without another reallocation.\n\n"
+         "The size of the array is not changed. The reallocation invalidates all views and slices of the array." )
+      .def(
+         "capacity",
+         []( const ArrayType& self )
+         {
+            return pytnl::containers::get_capacity( self );
+         },
+         "Returns the number of elements the array can hold without reallocation." )
+      .def(
+         "append",
+         []( ArrayType& self, ValueType value )
+         {
+            pytnl::containers::append_elements( self,
+                                                 1,
+                                                 [ & ]( ValueType* out )
+                                                 {
+                                                    *out = value;
+                                                 } );
+         },
+         nb::arg( "value" ),
+         "Appends an element to the end of the array.\n\n"
+         "When the capacity is exhausted, the array is reallocated with twice the capacity, so a sequence of "
+         "appends takes amortized constant time per element. Views and slices of the array stay valid (with "
+         "their original size) until the next reallocation, which invalidates them. Reallocations happen only "
+         "when the size exceeds `capacity()` and in `reserve`, `setSize`, `resize` and `reset`." )
+      .def(
+         "extend",
+         []( ArrayType& self, nb::handle data )
+         {
+            // arrays and views of the same type are copied directly
+            ConstViewType view;
+            if( nb::try_cast( data, view ) ) {
+               pytnl::gil_release_for_size release( view.getSize() );
+               pytnl::containers::append_elements( self,
+                                                   view.getSize(),
+                                                   [ & ]( ValueType* out )
+                                                   {
+                                                      if( view.getSize() > 0 )
+                                                         std::memcpy( static_cast< void* >( out ),
+                                                                      view.getData(),
+                                                                      static_cast< std::size_t >( view.getSize() ) * sizeof( ValueType ) );
+                                                   } );
+               return;
+            }
+
+            if( PyObject_CheckBuffer( data.ptr() ) ) {
+               pytnl::containers::conversion::BufferView buffer( data.ptr(), PyBUF_FORMAT | PyBUF_STRIDES );
+               if( buffer.view.ndim != 1 )
+                  throw nb::value_error(
+                     ( "expected a one-dimensional buffer, got " + std::to_string( buffer.view.ndim ) + " dimensions" ).c_str() );
+               pytnl::containers::append_elements( self,
+                                                   static_cast< IndexType >( buffer.view.shape[ 0 ] ),
+                                                   [ & ]( ValueType* out )
+                                                   {
+                                                      pytnl::containers::conversion::convert_buffer( buffer.view, out );
+                                                   } );
+               return;
+            }
+
+            if( nb::isinstance< nb::str >( data ) || ! PySequence_Check( data.ptr() ) )
+               throw nb::type_error( ( "expected an array, a sequence or an object supporting the buffer protocol, got "
+                                       + std::string( nb::type_name( data.type() ).c_str() ) )
+                                        .c_str() );
+            nb::object sequence = nb::steal( PySequence_Fast( data.ptr(), "expected a sequence" ) );
+            if( ! sequence.is_valid() )
+               throw nb::python_error();
+            PyObject** items = PySequence_Fast_ITEMS( sequence.ptr() );
+            pytnl::containers::append_elements( self,
+                                                static_cast< IndexType >( PySequence_Fast_GET_SIZE( sequence.ptr() ) ),
+                                                [ & ]( ValueType* out )
+                                                {
+                                                   const Py_ssize_t size = PySequence_Fast_GET_SIZE( sequence.ptr() );
+                                                   for( Py_ssize_t i = 0; i < size; i++ )
+                                                      out[ i ] = nb::cast< ValueType >( nb::handle( items[ i ] ) );
+                                                } );
+         },
+         nb::arg( "data" ),
+         nb::sig( "def extend(self, data: collections.abc.Buffer | collections.abc.Sequence[typing.Any]) -> None" ),
+         "Appends the elements of another array, a one-dimensional object supporting the buffer protocol or a "
+         "sequence to the end of the array.\n\n"
+         "The capacity grows geometrically as in `append`, the same rules for the invalidation of views apply." );
+}
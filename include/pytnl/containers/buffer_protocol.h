@@ -11,6 +11,8 @@
 
 #include <pytnl/pytnl.h>
 
+#include "copy_on_write.h"
+
 namespace pytnl::containers::buffer_protocol {
 
 struct BufferInfo
@@ -24,6 +26,21 @@ struct BufferInfo
    {}
 };
 
+//! \brief Detaches a copy-on-write array before exporting a writable buffer (the consumer may modify the data).
+template< typename ArrayType >
+bool
+detach_exporter( ArrayType& array ) noexcept
+{
+   try {
+      pytnl::containers::detach_for_export( array );
+      return true;
+   }
+   catch( const std::bad_alloc& ) {
+      PyErr_NoMemory();
+      return false;
+   }
+}
+
 template< typename T >
 constexpr const char*
 pybuffer_format()
@@ -47,6 +64,8 @@ pybuffer_format()
       return "l";
    else if constexpr( std::is_same_v< U, std::uint64_t > )
       return "L";
+   else if constexpr( std::is_same_v< U, pytnl::float16 > )
+      return "e";
    else if constexpr( std::is_same_v< U, float > )
       return "f";
    else if constexpr( std::is_same_v< U, double > )
@@ -56,6 +75,7 @@ pybuffer_format()
    else if constexpr( std::is_same_v< U, std::complex< double > > )
       return "Zd";
    else
+      // e.g. bfloat16, which does not have a format character in the struct module
       return nullptr;
 }
 
@@ -114,6 +134,10 @@ array_getbuffer( PyObject* exporter, Py_buffer* view, int flags )
    }
 
    ArrayType* obj = nb::inst_ptr< ArrayType >( nb::handle( exporter ) );
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      if( ! detach_exporter( *obj ) )
+         return -1;
+   }
    BufferInfo* info = new( std::nothrow ) BufferInfo( 1 );
    if( info == nullptr ) {
       PyErr_NoMemory();
@@ -187,6 +211,10 @@ ndarray_getbuffer( PyObject* exporter, Py_buffer* view, int flags )
    }
 
    NDArrayType* obj = nb::inst_ptr< NDArrayType >( nb::handle( exporter ) );
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      if( ! detach_exporter( *obj ) )
+         return -1;
+   }
 
    constexpr int ndim = static_cast< int >( NDArrayType::getDimension() );
    static_assert( ndim > 0, "NDArray dimension must be positive" );
@@ -326,6 +354,95 @@ static_vector_getbuffer( PyObject* exporter, Py_buffer* view, int flags )
    return 0;
 }
 
+template< typename StridedViewType >
+int
+strided_array_getbuffer( PyObject* exporter, Py_buffer* view, int flags )
+{
+   using ValueType = typename StridedViewType::ValueType;
+   using DeviceType = typename StridedViewType::DeviceType;
+
+   if( view == nullptr ) {
+      PyErr_SetString( PyExc_BufferError, "Py_buffer view cannot be NULL" );
+      return -1;
+   }
+
+   if constexpr( ! is_host_device_v< DeviceType > ) {
+      PyErr_SetString(
+         PyExc_BufferError,
+         "Buffer protocol is only available for host device arrays. "
+         "Use __dlpack__ / __cuda_array_interface__ for non-host memory." );
+      return -1;
+   }
+
+   constexpr const char* fmt = pybuffer_format< ValueType >();
+   if( ( flags & PyBUF_FORMAT ) && fmt == nullptr ) {
+      PyErr_SetString( PyExc_BufferError, "Unsupported ValueType for Python buffer format string" );
+      return -1;
+   }
+
+   StridedViewType* obj = nb::inst_ptr< StridedViewType >( nb::handle( exporter ) );
+
+   // consumers which do not request strides can handle only contiguous buffers
+   if( ( flags & PyBUF_STRIDES ) != PyBUF_STRIDES && obj->getStride() != 1 && obj->getSize() > 1 ) {
+      PyErr_SetString( PyExc_BufferError, "The strided array view is not contiguous" );
+      return -1;
+   }
+
+   BufferInfo* info = new( std::nothrow ) BufferInfo( 1 );
+   if( info == nullptr ) {
+      PyErr_NoMemory();
+      return -1;
+   }
+
+   Py_ssize_t size_py = 0;
+   if( ! checked_cast_to_py_ssize( static_cast< std::size_t >( obj->getSize() ), size_py ) ) {
+      delete info;
+      PyErr_SetString( PyExc_OverflowError, "Array size does not fit into Py_ssize_t" );
+      return -1;
+   }
+
+   Py_ssize_t itemsize_py = 0;
+   if( ! checked_cast_to_py_ssize( sizeof( std::remove_cv_t< ValueType > ), itemsize_py ) ) {
+      delete info;
+      PyErr_SetString( PyExc_OverflowError, "Item size does not fit into Py_ssize_t" );
+      return -1;
+   }
+
+   Py_ssize_t len_py = 0;
+   if( ! checked_mul_py_ssize( size_py, itemsize_py, len_py ) ) {
+      delete info;
+      PyErr_SetString( PyExc_OverflowError, "Total buffer byte size overflow" );
+      return -1;
+   }
+
+   // the stride may be negative, so checked_mul_py_ssize cannot be used
+   const auto stride = static_cast< std::size_t >( obj->getStride() < 0 ? -obj->getStride() : obj->getStride() );
+   Py_ssize_t stride_py = 0;
+   if( ! checked_cast_to_py_ssize( stride, stride_py ) || ! checked_mul_py_ssize( stride_py, itemsize_py, stride_py ) ) {
+      delete info;
+      PyErr_SetString( PyExc_OverflowError, "Stride computation overflow" );
+      return -1;
+   }
+
+   info->shape[ 0 ] = size_py;
+   info->strides[ 0 ] = obj->getStride() < 0 ? -stride_py : stride_py;
+
+   view->buf = const_cast< void* >( static_cast< const void* >( obj->getData() ) );
+   view->obj = exporter;
+   view->len = len_py;
+   view->readonly = std::is_const_v< ValueType > ? 1 : 0;
+   view->itemsize = itemsize_py;
+   view->format = const_cast< char* >( fmt );
+   view->ndim = 1;
+   view->shape = info->shape.data();
+   view->strides = info->strides.data();
+   view->suboffsets = nullptr;
+   view->internal = info;
+
+   Py_INCREF( exporter );
+   return 0;
+}
+
 inline void
 releasebuffer( PyObject* /* exporter */, Py_buffer* view )
 {
@@ -342,6 +459,17 @@ array_buffer_slots()
    return slots;
 }
 
+template< typename StridedViewType >
+inline PyType_Slot*
+strided_array_buffer_slots()
+{
+   static PyType_Slot slots[] = { { Py_bf_getbuffer,
+                                    reinterpret_cast< void* >( &strided_array_getbuffer< StridedViewType > ) },
+                                  { Py_bf_releasebuffer, reinterpret_cast< void* >( &releasebuffer ) },
+                                  { 0, nullptr } };
+   return slots;
+}
+
 template< typename NDArrayType >
 inline PyType_Slot*
 ndarray_buffer_slots()
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/staticFor.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Devices/Host.h>
+#include <TNL/TypeTraits.h>
+
+#include "copy_on_write.h"
+
+#ifdef HAVE_ZLIB
+
+   #include <zlib.h>
+
+namespace pytnl::containers::compression {
+
+/* Chunked compressed file format (all integers are 64-bit in the native byte
+ * order, like in TNL files):
+ *
+ *    magic number "PYTNLZ01"
+ *    length of the serialization type, serialization type (characters)
+ *    element size in bytes
+ *    number of dimensions, shape
+ *    number of elements per chunk, number of chunks
+ *    chunk index: byte offsets of the chunks (number of chunks + 1 values)
+ *    chunks compressed independently with zlib
+ *
+ * The chunk index allows decompressing only the chunks which overlap a given
+ * range of elements, and decompressing the chunks in parallel.
+ */
+constexpr char magic[] = "PYTNLZ01";
+
+struct ChunkedHeader
+{
+   std::string type;
+   std::uint64_t elementSize = 0;
+   std::vector< std::uint64_t > shape;
+   std::uint64_t chunkSize = 0;
+   std::vector< std::uint64_t > offsets;
+   // position of the first chunk in the file
+   std::uint64_t dataOffset = 0;
+
+   [[nodiscard]] std::uint64_t
+   getSize() const
+   {
+      std::uint64_t size = 1;
+      for( auto s : shape )
+         size *= s;
+      return size;
+   }
+};
+
+inline void
+write_u64( std::ofstream& file, std::uint64_t value )
+{
+   file.write( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+}
+
+inline std::uint64_t
+read_u64( std::ifstream& file, const std::string& filename )
+{
+   std::uint64_t value = 0;
+   if( ! file.read( reinterpret_cast< char* >( &value ), sizeof( value ) ) )
+      throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+   return value;
+}
+
+/**
+ * \brief Writes `data` (a contiguous array of elements of the given shape)
+ * to a chunked compressed file.
+ *
+ * The chunks are compressed in parallel in batches of a few chunks per
+ * thread, the batches are written sequentially, so the memory overhead is
+ * bounded regardless of the array size.
+ */
+inline void
+write_chunked( const std::string& filename,
+               const std::string& type,
+               const std::vector< std::uint64_t >& shape,
+               const void* data,
+               std::uint64_t elementSize,
+               std::uint64_t chunkSize,
+               int level )
+{
+   if( chunkSize == 0 )
+      throw nb::value_error( "the chunk size must be positive" );
+   if( level < 0 || level > 9 )
+      throw nb::value_error( "the compression level must be between 0 and 9" );
+
+   std::uint64_t size = 1;
+   for( auto s : shape )
+      size *= s;
+   const std::uint64_t chunks = ( size + chunkSize - 1 ) / chunkSize;
+
+   std::ofstream file( filename, std::ios::binary | std::ios::trunc );
+   if( ! file )
+      throw std::runtime_error( "failed to open the file '" + filename + "' for writing" );
+
+   file.write( magic, sizeof( magic ) - 1 );
+   write_u64( file, type.size() );
+   file.write( type.data(), static_cast< std::streamsize >( type.size() ) );
+   write_u64( file, elementSize );
+   write_u64( file, shape.size() );
+   for( auto s : shape )
+      write_u64( file, s );
+   write_u64( file, chunkSize );
+   write_u64( file, chunks );
+
+   // placeholder for the chunk index, it is written after the chunks
+   const std::streampos indexPosition = file.tellp();
+   std::vector< std::uint64_t > offsets( chunks + 1, 0 );
+   file.write( reinterpret_cast< const char* >( offsets.data() ),
+               static_cast< std::streamsize >( offsets.size() * sizeof( std::uint64_t ) ) );
+
+   const auto* bytes = static_cast< const unsigned char* >( data );
+   const std::uint64_t chunkBytes = chunkSize * elementSize;
+   const std::int64_t batch = 4 * TNL::Devices::Host::getMaxThreadsCount();
+   std::vector< std::vector< unsigned char > > buffers( batch );
+   std::vector< int > status( batch );
+
+   for( std::uint64_t first = 0; first < chunks; first += batch ) {
+      const std::int64_t count = std::min< std::uint64_t >( batch, chunks - first );
+   #ifdef HAVE_OPENMP
+      #pragma omp parallel for schedule( dynamic ) if( TNL::Devices::Host::isOMPEnabled() && count > 1 )
+   #endif
+      for( std::int64_t i = 0; i < count; i++ ) {
+         const std::uint64_t begin = ( first + i ) * chunkBytes;
+         const std::uint64_t length = std::min( chunkBytes, size * elementSize - begin );
+         uLongf compressedLength = compressBound( length );
+         buffers[ i ].resize( compressedLength );
+         status[ i ] = compress2( buffers[ i ].data(), &compressedLength, bytes + begin, length, level );
+         buffers[ i ].resize( compressedLength );
+      }
+      for( std::int64_t i = 0; i < count; i++ ) {
+         if( status[ i ] != Z_OK )
+            throw std::runtime_error( "zlib compression failed with error code " + std::to_string( status[ i ] ) );
+         file.write( reinterpret_cast< const char* >( buffers[ i ].data() ),
+                     static_cast< std::streamsize >( buffers[ i ].size() ) );
+         offsets[ first + i + 1 ] = offsets[ first + i ] + buffers[ i ].size();
+      }
+   }
+
+   file.seekp( indexPosition );
+   file.write( reinterpret_cast< const char* >( offsets.data() ),
+               static_cast< std::streamsize >( offsets.size() * sizeof( std::uint64_t ) ) );
+   if( ! file )
+      throw std::runtime_error( "failed to write the file '" + filename + "'" );
+}
+
+//! \brief Reads and validates the header of a chunked compressed file.
+inline ChunkedHeader
+read_chunked_header( std::ifstream& file,
+                     const std::string& filename,
+                     const std::string& expectedType,
+                     std::uint64_t elementSize )
+{
+   char fileMagic[ sizeof( magic ) - 1 ];
+   if( ! file.read( fileMagic, sizeof( fileMagic ) ) || std::memcmp( fileMagic, magic, sizeof( fileMagic ) ) != 0 )
+      throw nb::value_error( ( "the file '" + filename + "' is not a chunked compressed PyTNL file" ).c_str() );
+
+   ChunkedHeader header;
+   header.type.resize( read_u64( file, filename ) );
+   if( ! file.read( header.type.data(), static_cast< std::streamsize >( header.type.size() ) ) )
+      throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+   if( header.type != expectedType )
+      throw nb::value_error(
+         ( "the file '" + filename + "' contains elements of type '" + header.type + "', expected: " + expectedType ).c_str() );
+
+   header.elementSize = read_u64( file, filename );
+   if( header.elementSize != elementSize )
+      throw nb::value_error( ( "the element size in the file '" + filename + "' does not match" ).c_str() );
+   header.shape.resize( read_u64( file, filename ) );
+   for( auto& s : header.shape )
+      s = read_u64( file, filename );
+   header.chunkSize = read_u64( file, filename );
+   const std::uint64_t chunks = read_u64( file, filename );
+   if( header.chunkSize == 0 || chunks != ( header.getSize() + header.chunkSize - 1 ) / header.chunkSize )
+      throw nb::value_error( ( "the chunk index in the file '" + filename + "' is corrupted" ).c_str() );
+   header.offsets.resize( chunks + 1 );
+   if( ! file.read( reinterpret_cast< char* >( header.offsets.data() ),
+                    static_cast< std::streamsize >( header.offsets.size() * sizeof( std::uint64_t ) ) ) )
+      throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+   header.dataOffset = file.tellg();
+   return header;
+}
+
+/**
+ * \brief Decompresses the elements `[begin, end)` from a chunked compressed
+ * file into `out`.
+ *
+ * Only the chunks overlapping the range are read, they are decompressed in
+ * parallel.
+ */
+inline void
+read_chunked_range( std::ifstream& file,
+                    const std::string& filename,
+                    const ChunkedHeader& header,
+                    std::uint64_t begin,
+                    std::uint64_t end,
+                    void* out )
+{
+   if( begin >= end )
+      return;
+   const std::uint64_t elementSize = header.elementSize;
+   const std::uint64_t firstChunk = begin / header.chunkSize;
+   const std::uint64_t lastChunk = ( end - 1 ) / header.chunkSize + 1;
+
+   // read the compressed data of all chunks in the range at once
+   const std::uint64_t compressedBegin = header.offsets[ firstChunk ];
+   std::vector< unsigned char > compressed( header.offsets[ lastChunk ] - compressedBegin );
+   file.seekg( static_cast< std::streamoff >( header.dataOffset + compressedBegin ) );
+   if( ! file.read( reinterpret_cast< char* >( compressed.data() ), static_cast< std::streamsize >( compressed.size() ) ) )
+      throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+
+   auto* output = static_cast< unsigned char* >( out );
+   const std::int64_t count = lastChunk - firstChunk;
+   std::vector< int > status( count, Z_OK );
+   #ifdef HAVE_OPENMP
+      #pragma omp parallel for schedule( dynamic ) if( TNL::Devices::Host::isOMPEnabled() && count > 1 )
+   #endif
+   for( std::int64_t i = 0; i < count; i++ ) {
+      const std::uint64_t c = firstChunk + i;
+      const std::uint64_t chunkBegin = c * header.chunkSize;
+      const std::uint64_t chunkEnd = std::min( chunkBegin + header.chunkSize, header.getSize() );
+      const unsigned char* source = compressed.data() + ( header.offsets[ c ] - compressedBegin );
+      const uLong sourceLength = header.offsets[ c + 1 ] - header.offsets[ c ];
+      uLongf length = ( chunkEnd - chunkBegin ) * elementSize;
+      if( chunkBegin >= begin && chunkEnd <= end ) {
+         // the whole chunk is decompressed in place
+         status[ i ] = uncompress( output + ( chunkBegin - begin ) * elementSize, &length, source, sourceLength );
+      }
+      else {
+         // the chunk overlaps the boundary of the range
+         std::vector< unsigned char > buffer( length );
+         status[ i ] = uncompress( buffer.data(), &length, source, sourceLength );
+         const std::uint64_t copyBegin = std::max( chunkBegin, begin );
+         const std::uint64_t copyEnd = std::min( chunkEnd, end );
+         std::memcpy( output + ( copyBegin - begin ) * elementSize,
+                      buffer.data() + ( copyBegin - chunkBegin ) * elementSize,
+                      ( copyEnd - copyBegin ) * elementSize );
+      }
+      if( status[ i ] == Z_OK && length != ( chunkEnd - chunkBegin ) * elementSize )
+         status[ i ] = Z_DATA_ERROR;
+   }
+   for( int s : status )
+      if( s != Z_OK )
+         throw nb::value_error(
+            ( "the file '" + filename + "' is corrupted (zlib error code " + std::to_string( s ) + ")" ).c_str() );
+}
+
+//! \brief Opens a chunked compressed file and reads its header.
+template< typename Value, typename Index >
+ChunkedHeader
+open_chunked( std::ifstream& file, const std::string& filename )
+{
+   file.open( filename, std::ios::binary );
+   if( ! file )
+      throw std::runtime_error( "failed to open the file '" + filename + "' for reading" );
+   return read_chunked_header(
+      file, filename, pytnl::Array< Value, TNL::Devices::Host, Index >::getSerializationType(), sizeof( Value ) );
+}
+
+}  // namespace pytnl::containers::compression
+
+/* Chunked compressed serialization of arrays, vectors and their views. The
+ * file format is specific to PyTNL (see pytnl::containers::compression), it
+ * is not readable by `load`. Data on GPUs are transferred through a temporary
+ * host array. The GIL is released regardless of the array size.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_compressed_serialization( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = std::remove_const_t< typename ArrayType::ValueType >;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+   using HostArray = pytnl::Array< ValueType, TNL::Devices::Host, IndexType >;
+
+   array.def(
+      "saveCompressed",
+      []( const ArrayType& self, const std::string& filename, IndexType chunkSize, int level )
+      {
+         if( chunkSize <= 0 )
+            throw nb::value_error( "the chunk size must be positive" );
+         nb::gil_scoped_release release;
+         const std::vector< std::uint64_t > shape{ static_cast< std::uint64_t >( self.getSize() ) };
+         const std::string type = HostArray::getSerializationType();
+         if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+            pytnl::containers::compression::write_chunked(
+               filename, type, shape, self.getData(), sizeof( ValueType ), chunkSize, level );
+         else {
+            HostArray host;
+            host = self.getConstView();
+            pytnl::containers::compression::write_chunked(
+               filename, type, shape, host.getData(), sizeof( ValueType ), chunkSize, level );
+         }
+      },
+      nb::arg( "filename" ),
+      nb::kw_only(),
+      nb::arg( "chunkSize" ) = 1 << 20,
+      nb::arg( "level" ) = 1,
+      "Saves the array to a chunked compressed file.\n\n"
+      "`chunkSize` is the number of elements per chunk, `level` is the zlib compression level (0-9). "
+      "The chunks are compressed in parallel and can be decompressed independently by `loadCompressed`." );
+
+   if constexpr( ! TNL::IsViewType< ArrayType >::value ) {
+      array.def(
+         "loadCompressed",
+         []( ArrayType& self, const std::string& filename, IndexType begin, IndexType end )
+         {
+            pytnl::containers::detach( self );
+            nb::gil_scoped_release release;
+            std::ifstream file;
+            const auto header = pytnl::containers::compression::open_chunked< ValueType, IndexType >( file, filename );
+            const auto size = static_cast< IndexType >( header.getSize() );
+            if( end == 0 )
+               end = size;
+            if( begin < 0 || end < begin || end > size )
+               throw nb::index_error( ( "invalid range [" + std::to_string( begin ) + ", " + std::to_string( end )
+                                        + ") for an array of size " + std::to_string( size ) )
+                                         .c_str() );
+            if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+               self.setSize( end - begin );
+               pytnl::containers::compression::read_chunked_range( file, filename, header, begin, end, self.getData() );
+            }
+            else {
+               HostArray host( end - begin );
+               pytnl::containers::compression::read_chunked_range( file, filename, header, begin, end, host.getData() );
+               self = host;
+            }
+         },
+         nb::arg( "filename" ),
+         nb::arg( "begin" ) = 0,
+         nb::arg( "end" ) = 0,
+         "Loads the elements `[begin, end)` from a file written by `saveCompressed`.\n\n"
+         "Only the chunks overlapping the range are read and decompressed (in parallel). "
+         "`end = 0` means the end of the array." );
+   }
+}
+
+/* Chunked compressed serialization of N-dimensional arrays. The storage array
+ * is saved together with the sizes. The bound NDArray types are row-major, so
+ * a range of indices of the first dimension is a contiguous range of the
+ * storage array and it can be loaded without decompressing the whole file.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_ndarray_compressed_serialization( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = std::remove_const_t< typename ArrayType::ValueType >;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+   using HostArray = pytnl::Array< ValueType, TNL::Devices::Host, IndexType >;
+   constexpr std::size_t dim = ArrayType::getDimension();
+
+   array.def(
+      "saveCompressed",
+      []( const ArrayType& self, const std::string& filename, IndexType chunkSize, int level )
+      {
+         if( chunkSize <= 0 )
+            throw nb::value_error( "the chunk size must be positive" );
+         std::vector< std::uint64_t > shape( dim );
+         std::uint64_t size = 1;
+         TNL::Algorithms::staticFor< std::size_t, 0, dim >(
+            [ & ]( auto i )
+            {
+               shape[ i ] = self.template getSize< i >();
+               size *= shape[ i ];
+            } );
+         if( size != static_cast< std::uint64_t >( self.getStorageSize() ) )
+            throw nb::value_error( "arrays with overlaps cannot be saved in the compressed format" );
+
+         nb::gil_scoped_release release;
+         const std::string type = HostArray::getSerializationType();
+         if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+            pytnl::containers::compression::write_chunked(
+               filename, type, shape, self.getData(), sizeof( ValueType ), chunkSize, level );
+         else {
+            HostArray host;
+            host = TNL::Containers::ArrayView< const ValueType, DeviceType, IndexType >( self.getData(),
+                                                                                         self.getStorageSize() );
+            pytnl::containers::compression::write_chunked(
+               filename, type, shape, host.getData(), sizeof( ValueType ), chunkSize, level );
+         }
+      },
+      nb::arg( "filename" ),
+      nb::kw_only(),
+      nb::arg( "chunkSize" ) = 1 << 20,
+      nb::arg( "level" ) = 1,
+      "Saves the array to a chunked compressed file.\n\n"
+      "`chunkSize` is the number of elements per chunk, `level` is the zlib compression level (0-9)." );
+
+   if constexpr( ! TNL::IsViewType< ArrayType >::value ) {
+      array.def(
+         "loadCompressed",
+         []( ArrayType& self, const std::string& filename, IndexType begin, IndexType end )
+         {
+            pytnl::containers::detach( self );
+            nb::gil_scoped_release release;
+            std::ifstream file;
+            const auto header = pytnl::containers::compression::open_chunked< ValueType, IndexType >( file, filename );
+            if( header.shape.size() != dim )
+               throw nb::value_error( ( "the file '" + filename + "' contains an array of dimension "
+                                        + std::to_string( header.shape.size() ) + ", expected " + std::to_string( dim ) )
+                                         .c_str() );
+            const auto rows = static_cast< IndexType >( header.shape[ 0 ] );
+            if( end == 0 )
+               end = rows;
+            if( begin < 0 || end < begin || end > rows )
+               throw nb::index_error( ( "invalid range [" + std::to_string( begin ) + ", " + std::to_string( end )
+                                        + ") of the first dimension of size " + std::to_string( rows ) )
+                                         .c_str() );
+
+            std::array< IndexType, dim > sizes;
+            std::uint64_t rowSize = 1;
+            for( std::size_t i = 0; i < dim; i++ ) {
+               sizes[ i ] = static_cast< IndexType >( header.shape[ i ] );
+               if( i > 0 )
+                  rowSize *= header.shape[ i ];
+            }
+            sizes[ 0 ] = end - begin;
+            std::apply(
+               [ & ]( auto... sizes )
+               {
+                  self.setSizes( sizes... );
+               },
+               sizes );
+
+            if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+               pytnl::containers::compression::read_chunked_range(
+                  file, filename, header, begin * rowSize, end * rowSize, self.getData() );
+            else {
+               HostArray host( self.getStorageSize() );
+               pytnl::containers::compression::read_chunked_range(
+                  file, filename, header, begin * rowSize, end * rowSize, host.getData() );
+               self.getStorageArrayView() = host;
+            }
+         },
+         nb::arg( "filename" ),
+         nb::arg( "begin" ) = 0,
+         nb::arg( "end" ) = 0,
+         "Loads the array from a file written by `saveCompressed`, the sizes are set from the file.\n\n"
+         "Only the indices `[begin, end)` of the first dimension are loaded (`end = 0` means the end), "
+         "only the chunks overlapping this range are read and decompressed." );
+   }
+}
+
+#else
+
+// the compressed serialization is not available without zlib
+template< typename ArrayType, typename... Args >
+void
+def_compressed_serialization( nb::class_< ArrayType, Args... >& )
+{}
+
+template< typename ArrayType, typename... Args >
+void
+def_ndarray_compressed_serialization( nb::class_< ArrayType, Args... >& )
+{}
+
+#endif
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <Python.h>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Containers/Array.h>
+#include <TNL/TypeTraits.h>
+
+namespace pytnl::containers::conversion {
+
+//! \brief RAII wrapper for a buffer obtained via `PyObject_GetBuffer`.
+class BufferView
+{
+public:
+   BufferView( PyObject* obj, int flags )
+   {
+      if( PyObject_GetBuffer( obj, &view, flags ) != 0 )
+         throw nb::python_error();
+   }
+
+   BufferView( const BufferView& ) = delete;
+   BufferView&
+   operator=( const BufferView& ) = delete;
+
+   ~BufferView()
+   {
+      PyBuffer_Release( &view );
+   }
+
+   Py_buffer view{};
+};
+
+/**
+ * \brief Checks if `value` was converted to `result` without overflow.
+ *
+ * Integers must be represented exactly (e.g. a negative value or a `uint64`
+ * value above 2^63 does not fit into `int64`) and finite floating-point values
+ * must stay finite (e.g. 1e5 does not fit into `float16`). Rounding to the
+ * nearest representable floating-point value is not an error.
+ */
+template< typename Source, typename Target >
+bool
+converted_in_range( const Source& value, const Target& result )
+{
+   if constexpr( std::is_integral_v< Target > ) {
+      // the sign check catches the wrap-around between signed and unsigned types
+      return static_cast< Source >( result ) == value && ( result < Target{} ) == ( value < Source{} );
+   }
+   else if constexpr( std::is_floating_point_v< Target > || pytnl::is_half_v< Target > ) {
+      using SourceCompute = pytnl::compute_type_t< Source >;
+      if constexpr( std::is_floating_point_v< SourceCompute > )
+         if( ! std::isfinite( static_cast< SourceCompute >( value ) ) )
+            return true;
+      return std::isfinite( static_cast< pytnl::compute_type_t< Target > >( result ) );
+   }
+   else
+      return true;
+}
+
+/**
+ * \brief Copies `size` elements of a (possibly strided) buffer into `out`,
+ * converting them from `Source` to `Target`.
+ *
+ * Returns `false` if some element does not fit into `Target` (see
+ * `converted_in_range`).
+ */
+template< typename Source, typename Target >
+bool
+convert_elements( const char* data, Py_ssize_t size, Py_ssize_t stride, Target* out )
+{
+   if constexpr( std::is_same_v< Source, Target > ) {
+      if( stride == static_cast< Py_ssize_t >( sizeof( Source ) ) ) {
+         std::memcpy( out, data, static_cast< std::size_t >( size ) * sizeof( Source ) );
+         return true;
+      }
+   }
+   bool in_range = true;
+   for( Py_ssize_t i = 0; i < size; i++ ) {
+      Source value;
+      // memcpy avoids misaligned reads from packed buffers
+      std::memcpy( &value, data + i * stride, sizeof( Source ) );
+      out[ i ] = static_cast< Target >( value );
+      if constexpr( ! std::is_same_v< Source, Target > )
+         in_range = in_range && converted_in_range( value, out[ i ] );
+   }
+   return in_range;
+}
+
+//! \brief Selects the C++ type of the buffer elements and converts them to `Target`.
+template< typename Target >
+void
+convert_buffer( const Py_buffer& buffer, Target* out )
+{
+   std::string format = buffer.format != nullptr ? buffer.format : "B";
+   // native or little-endian byte order prefixes are accepted, the item size is checked below
+   if( ! format.empty() && ( format[ 0 ] == '@' || format[ 0 ] == '=' || ( format[ 0 ] == '<' && ! PY_BIG_ENDIAN ) ) )
+      format.erase( 0, 1 );
+
+   const Py_ssize_t size = buffer.shape[ 0 ];
+   const Py_ssize_t stride = buffer.strides != nullptr ? buffer.strides[ 0 ] : buffer.itemsize;
+   const char* data = static_cast< const char* >( buffer.buf );
+   const Py_ssize_t itemsize = buffer.itemsize;
+
+   constexpr bool to_bool = std::is_same_v< Target, bool >;
+   constexpr bool to_integer = std::is_integral_v< Target > && ! to_bool;
+   constexpr bool to_floating = std::is_floating_point_v< Target > || pytnl::is_half_v< Target >;
+   constexpr bool to_complex = TNL::is_complex_v< Target >;
+
+   auto convert = [ & ]( auto source_tag )
+   {
+      using Source = decltype( source_tag );
+      if( itemsize != static_cast< Py_ssize_t >( sizeof( Source ) ) )
+         throw nb::type_error( ( "unsupported item size " + std::to_string( itemsize ) + " for buffer format '" + format + "'" ).c_str() );
+      bool in_range = false;
+      {
+         pytnl::gil_release_for_size release( size );
+         in_range = convert_elements< Source >( data, size, stride, out );
+      }
+      if( ! in_range ) {
+         const std::string message =
+            "an element of the buffer with format '" + format + "' is out of the range of the value type of the array";
+         PyErr_SetString( PyExc_OverflowError, message.c_str() );
+         throw nb::python_error();
+      }
+   };
+
+   if( format == "?" ) {
+      if constexpr( to_bool || to_integer || to_floating || to_complex ) {
+         convert( bool{} );
+         return;
+      }
+   }
+   else if( format.size() == 1 && std::string( "bhilqn" ).find( format[ 0 ] ) != std::string::npos ) {
+      if constexpr( to_integer || to_floating || to_complex ) {
+         switch( itemsize ) {
+            case 1:
+               convert( std::int8_t{} );
+               return;
+            case 2:
+               convert( std::int16_t{} );
+               return;
+            case 4:
+               convert( std::int32_t{} );
+               return;
+            case 8:
+               convert( std::int64_t{} );
+               return;
+         }
+      }
+   }
+   else if( format.size() == 1 && std::string( "BHILQN" ).find( format[ 0 ] ) != std::string::npos ) {
+      if constexpr( to_integer || to_floating || to_complex ) {
+         switch( itemsize ) {
+            case 1:
+               convert( std::uint8_t{} );
+               return;
+            case 2:
+               convert( std::uint16_t{} );
+               return;
+            case 4:
+               convert( std::uint32_t{} );
+               return;
+            case 8:
+               convert( std::uint64_t{} );
+               return;
+         }
+      }
+   }
+   else if( format == "e" ) {
+      if constexpr( to_floating ) {
+         convert( pytnl::float16{} );
+         return;
+      }
+   }
+   else if( format == "f" || format == "d" ) {
+      if constexpr( to_floating || to_complex ) {
+         if( format == "f" )
+            convert( float{} );
+         else
+            convert( double{} );
+         return;
+      }
+   }
+   else if( format == "Zf" || format == "Zd" ) {
+      if constexpr( to_complex ) {
+         if( format == "Zf" )
+            convert( std::complex< float >{} );
+         else
+            convert( std::complex< double >{} );
+         return;
+      }
+   }
+   throw nb::type_error( ( "cannot convert a buffer with format '" + std::string( buffer.format != nullptr ? buffer.format : "B" )
+                           + "' to the value type of the array" )
+                            .c_str() );
+}
+
+/**
+ * \brief Fills a host array from a Python object: either an object supporting
+ * the buffer protocol (e.g. `array.array`, `bytes`, NumPy arrays) or a
+ * sequence (e.g. `list` or `tuple`).
+ *
+ * The array is allocated only once and buffers are copied (and converted)
+ * without creating any Python objects.
+ */
+template< typename HostArray >
+void
+fill_from_python( HostArray& array, nb::handle data )
+{
+   using Value = typename HostArray::ValueType;
+   using Index = typename HostArray::IndexType;
+
+   if( PyObject_CheckBuffer( data.ptr() ) ) {
+      BufferView buffer( data.ptr(), PyBUF_FORMAT | PyBUF_STRIDES );
+      if( buffer.view.ndim != 1 )
+         throw nb::value_error( ( "expected a one-dimensional buffer, got " + std::to_string( buffer.view.ndim ) + " dimensions" ).c_str() );
+      array.setSize( static_cast< Index >( buffer.view.shape[ 0 ] ) );
+      convert_buffer( buffer.view, array.getData() );
+      return;
+   }
+
+   if( nb::isinstance< nb::str >( data ) || ! PySequence_Check( data.ptr() ) )
+      throw nb::type_error( ( "expected a sequence or an object supporting the buffer protocol, got "
+                              + std::string( nb::type_name( data.type() ).c_str() ) )
+                               .c_str() );
+
+   nb::object sequence = nb::steal( PySequence_Fast( data.ptr(), "expected a sequence" ) );
+   if( ! sequence.is_valid() )
+      throw nb::python_error();
+   const Py_ssize_t size = PySequence_Fast_GET_SIZE( sequence.ptr() );
+   PyObject** items = PySequence_Fast_ITEMS( sequence.ptr() );
+   array.setSize( static_cast< Index >( size ) );
+   Value* out = array.getData();
+   for( Py_ssize_t i = 0; i < size; i++ )
+      out[ i ] = nb::cast< Value >( nb::handle( items[ i ] ) );
+}
+
+//! \brief Creates a Python list from the elements of a host array.
+template< typename HostArray >
+nb::list
+to_list( const HostArray& array )
+{
+   const auto size = array.getSize();
+   const auto* data = array.getData();
+   nb::list result = nb::steal< nb::list >( PyList_New( static_cast< Py_ssize_t >( size ) ) );
+   if( ! result.is_valid() )
+      throw nb::python_error();
+   for( std::remove_const_t< decltype( size ) > i = 0; i < size; i++ )
+      PyList_SET_ITEM( result.ptr(), static_cast< Py_ssize_t >( i ), nb::cast( data[ i ] ).release().ptr() );
+   return result;
+}
+
+}  // namespace pytnl::containers::conversion
+
+/* Bulk constructor of arrays and vectors from Python sequences and buffers.
+ * It must be registered after the constructors taking the size, and it
+ * rejects integers, so that an integer argument (including NumPy integers,
+ * which match the size constructors only in the second, converting pass of
+ * the overload resolution) is not interpreted as data.
+ */
+template< typename ArrayType, typename Scope >
+void
+def_bulk_constructor( Scope& scope )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+
+   scope.def(
+      "__init__",
+      []( ArrayType* self, nb::handle data )
+      {
+         // NumPy integer scalars support the buffer protocol (with 0 dimensions), so it is not checked
+         if( PyIndex_Check( data.ptr() ) && ! PySequence_Check( data.ptr() ) )
+            throw nb::next_overload();
+         ArrayType array;
+         if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+            pytnl::containers::conversion::fill_from_python( array, data );
+         else {
+            pytnl::Array< ValueType, TNL::Devices::Host, IndexType > host_array;
+            pytnl::containers::conversion::fill_from_python( host_array, data );
+            pytnl::gil_release_for_size release( host_array.getSize() );
+            array = host_array;
+         }
+         new( self ) ArrayType( std::move( array ) );
+      },
+      nb::arg( "data" ),
+      nb::sig( "def __init__(self, data: collections.abc.Buffer | collections.abc.Sequence[typing.Any]) -> None" ),
+      "Creates an array from the elements of a sequence or a one-dimensional object supporting the buffer protocol.\n\n"
+      "The elements of buffers are converted to the value type of the array if the kinds are compatible "
+      "(e.g. integers to floating-point numbers, but not vice versa), otherwise `TypeError` is raised. "
+      "Values out of the range of the value type raise `OverflowError`, floating-point values are rounded "
+      "to the nearest representable value." );
+}
+
+template< typename ArrayType, typename Scope >
+void
+def_tolist( Scope& scope )
+{
+   using ValueType = std::remove_const_t< typename ArrayType::ValueType >;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+
+   scope.def(
+      "tolist",
+      []( const ArrayType& self )
+      {
+         if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > )
+            return pytnl::containers::conversion::to_list( self );
+         else {
+            pytnl::Array< ValueType, TNL::Devices::Host, IndexType > host_array;
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               host_array = self;
+            }
+            return pytnl::containers::conversion::to_list( host_array );
+         }
+      },
+      "Returns the elements of the array as a Python list." );
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include <pytnl/pytnl.h>
+#include <pytnl/CachingAllocator.h>
+
+namespace pytnl::containers {
+
+/* Copy-on-write copies of host arrays (enabled by
+ * `pytnl.containers.setCopyOnWrite`). `__copy__` then returns an array which
+ * owns the same block of the caching pool as the original, the pool keeps
+ * track of the number of owners and releases the block with the last one.
+ * Every binding which writes into an array calls `detach` first, so the
+ * array which is modified first gets its own copy of the data (in a single
+ * bulk copy) and the other owners are not affected.
+ *
+ * Writable views and exports (views, slices, NumPy/DLPack/buffer exports)
+ * write into the block directly, so they are created by `detach_for_export`,
+ * which also marks the block as exported. `__copy__` of an array whose block
+ * is marked returns a deep copy, otherwise the copy would see the writes
+ * through the views which existed before it was made.
+ */
+
+template< typename T, typename = void >
+struct is_ndarray : std::false_type
+{};
+
+template< typename T >
+struct is_ndarray< T, std::void_t< decltype( std::declval< T& >().getStorageArray() ) > > : std::true_type
+{};
+
+template< typename T, typename = void >
+struct has_caching_allocator : std::false_type
+{};
+
+template< typename T >
+struct has_caching_allocator< T, std::void_t< typename T::AllocatorType > >
+: std::is_same< typename T::AllocatorType, pytnl::allocators::CachingHost< typename T::ValueType > >
+{};
+
+//! \brief Checks if copies of `ArrayType` can share their data (arrays and NDArrays in the caching pool).
+template< typename ArrayType >
+constexpr bool
+supports_copy_on_write()
+{
+   if constexpr( is_ndarray< ArrayType >::value )
+      return has_caching_allocator< std::decay_t< decltype( std::declval< ArrayType& >().getStorageArray() ) > >::value;
+   else
+      return has_caching_allocator< ArrayType >::value;
+}
+
+// access to the protected members of TNL::Containers::Array
+template< typename ArrayType >
+struct ArrayStorageAccess : public ArrayType
+{
+   static auto&
+   dataOf( ArrayType& array )
+   {
+      return array.*( &ArrayStorageAccess::data );
+   }
+
+   static auto&
+   sizeOf( ArrayType& array )
+   {
+      return array.*( &ArrayStorageAccess::size );
+   }
+};
+
+//! \brief Returns `true` if `__copy__` should return a copy-on-write copy of `array`.
+template< typename ArrayType >
+bool
+use_copy_on_write( const ArrayType& array )
+{
+   if constexpr( supports_copy_on_write< ArrayType >() ) {
+      auto& pool = pytnl::allocators::CachingPool::getInstance();
+      if( ! pool.isCopyOnWrite() )
+         return false;
+      // writable views or exports of the data may exist
+      if constexpr( is_ndarray< ArrayType >::value )
+         return ! pool.isExported( array.getStorageArray().getData() );
+      else
+         return ! pool.isExported( array.getData() );
+   }
+   else
+      return false;
+}
+
+//! \brief Returns a copy of `array` which shares the data with `array` until one of them is modified.
+template< typename ArrayType >
+ArrayType
+shallow_copy( const ArrayType& array )
+{
+   static_assert( supports_copy_on_write< ArrayType >() );
+   if constexpr( is_ndarray< ArrayType >::value ) {
+      // copy the indexer without the data, then link the storage arrays
+      auto& storage = const_cast< ArrayType& >( array ).getStorageArray();
+      std::decay_t< decltype( storage ) > tmp;
+      storage.swap( tmp );
+      ArrayType result( array );
+      storage.swap( tmp );
+      auto linked = shallow_copy( storage );
+      result.getStorageArray().swap( linked );
+      return result;
+   }
+   else {
+      using Access = ArrayStorageAccess< ArrayType >;
+      ArrayType& source = const_cast< ArrayType& >( array );
+      ArrayType result;
+      if( source.getSize() > 0 ) {
+         pytnl::allocators::CachingPool::getInstance().share( Access::dataOf( source ) );
+         Access::dataOf( result ) = Access::dataOf( source );
+         Access::sizeOf( result ) = Access::sizeOf( source );
+      }
+      return result;
+   }
+}
+
+//! \brief Gives `array` its own copy of the data if it is shared with a copy-on-write copy.
+template< typename ArrayType >
+void
+detach( ArrayType& array )
+{
+   if constexpr( is_ndarray< ArrayType >::value ) {
+      detach( array.getStorageArray() );
+   }
+   else if constexpr( has_caching_allocator< ArrayType >::value ) {
+      if( array.getSize() > 0 && pytnl::allocators::CachingPool::getInstance().isShared( array.getData() ) ) {
+         // the copy is a new block, the swap releases one owner of the shared block
+         ArrayType copy( array );
+         array.swap( copy );
+      }
+   }
+}
+
+/**
+ * \brief Prepares `array` for the creation of a writable view or export of its
+ * data: detaches it from its copy-on-write copies and marks its block, so
+ * that `__copy__` does not share the block while the export may exist.
+ */
+template< typename ArrayType >
+void
+detach_for_export( ArrayType& array )
+{
+   if constexpr( is_ndarray< ArrayType >::value ) {
+      detach_for_export( array.getStorageArray() );
+   }
+   else if constexpr( has_caching_allocator< ArrayType >::value ) {
+      detach( array );
+      if( array.getSize() > 0 )
+         pytnl::allocators::CachingPool::getInstance().setExported( array.getData() );
+   }
+}
+
+}  // namespace pytnl::containers
+
+/* Implicit conversion from an array to its view. A non-const view may be used
+ * to modify the data, so the array is detached from its copy-on-write copies
+ * and marked as exported first.
+ */
+template< typename ViewType, typename ArrayType, typename Scope >
+void
+def_view_from_array( Scope& scope )
+{
+   if constexpr( std::is_const_v< typename ViewType::ValueType > ) {
+      scope.def( nb::init_implicit< ArrayType& >() );
+   }
+   else {
+      scope.def( "__init__",
+                 []( ViewType* self, ArrayType& array )
+                 {
+                    pytnl::containers::detach_for_export( array );
+                    new( self ) ViewType( array.getView() );
+                 } );
+      nb::implicitly_convertible< ArrayType, ViewType >();
+   }
+}
@@ -0,0 +1,534 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/parallelFor.h>
+#include <TNL/Algorithms/reduce.h>
+#include <TNL/Containers/Vector.h>
+#include <TNL/Math.h>
+#include <TNL/TypeTraits.h>
+
+/* Lazily evaluated vector expressions
+ *
+ * TNL expression templates are composed at compile time, so an expression
+ * built at run time in Python cannot be mapped onto them. Instead, the Python
+ * side flattens the expression tree into a program in postfix notation, which
+ * is interpreted here block by block: each thread evaluates the whole program
+ * for a small block of elements using registers that stay in the cache, so the
+ * input and output vectors are traversed only once regardless of the number of
+ * operations in the expression.
+ */
+namespace pytnl::containers::expressions {
+
+enum class Opcode : std::uint8_t
+{
+   // operands (the second member of the instruction is the operand index)
+   Vector,
+   Scalar,
+   // binary operations
+   Add,
+   Sub,
+   Mul,
+   Div,
+   Min,
+   Max,
+   // unary operations
+   Neg,
+   Abs,
+   Sqrt,
+   Exp,
+   Log,
+   Sin,
+   Cos,
+};
+
+enum class Reduction : std::uint8_t
+{
+   Sum,
+   Product,
+   Min,
+   Max,
+   // reductions returning the norm type (a real number even for complex vectors)
+   AbsSum,
+   SquaredAbsSum,
+   AbsMax,
+};
+
+template< typename Real >
+constexpr bool is_ordered_v = ! TNL::is_complex_v< Real >;
+
+template< typename Real >
+constexpr bool is_floating_or_complex_v = std::is_floating_point_v< Real > || TNL::is_complex_v< Real >;
+
+inline bool
+is_binary( Opcode op )
+{
+   return op >= Opcode::Add && op <= Opcode::Max;
+}
+
+template< typename Real, typename Index >
+class Program
+{
+public:
+   using Instruction = std::pair< Opcode, Index >;
+   using ConstViewType = TNL::Containers::VectorView< std::add_const_t< Real >, TNL::Devices::Host, Index >;
+   using NormType = decltype( std::abs( Real{} ) );
+
+   //! \brief Number of elements processed at once by each thread.
+   static constexpr Index blockSize = 256;
+
+   Program( std::vector< Instruction > code, std::vector< ConstViewType > vectors, std::vector< Real > scalars )
+   : code( std::move( code ) ),
+     vectors( std::move( vectors ) ),
+     scalars( std::move( scalars ) )
+   {
+      validate();
+   }
+
+   [[nodiscard]] Index
+   getSize() const
+   {
+      return size;
+   }
+
+   //! \brief Evaluates the expression into `out`, which may alias the operands element-wise.
+   void
+   evaluate( TNL::Containers::VectorView< Real, TNL::Devices::Host, Index > out ) const
+   {
+      if( out.getSize() != size )
+         throw nb::value_error( ( "the output vector has size " + std::to_string( out.getSize() )
+                                  + ", but the expression has size " + std::to_string( size ) )
+                                   .c_str() );
+
+      pytnl::gil_release_for_size release( size );
+      Real* result = out.getData();
+      TNL::Algorithms::parallelFor< TNL::Devices::Host >( Index{ 0 },
+                                                          getBlocksCount(),
+                                                          [ & ]( Index block )
+                                                          {
+                                                             const Index begin = block * blockSize;
+                                                             const Index end = std::min( begin + blockSize, size );
+                                                             const Real* values = evaluateBlock( begin, end );
+                                                             for( Index i = begin; i < end; i++ )
+                                                                result[ i ] = values[ i - begin ];
+                                                          } );
+   }
+
+   //! \brief Reduces the expression with a reduction which returns the value type.
+   [[nodiscard]] Real
+   reduce( Reduction reduction ) const
+   {
+      switch( reduction ) {
+         case Reduction::Sum:
+            return reduceBlocks< Real >(
+               Real{ 0 },
+               [ & ]( Real& result, const Real& value )
+               {
+                  result += value;
+               },
+               std::plus<>{} );
+         case Reduction::Product:
+            return reduceBlocks< Real >(
+               Real{ 1 },
+               [ & ]( Real& result, const Real& value )
+               {
+                  result *= value;
+               },
+               std::multiplies<>{} );
+         case Reduction::Min:
+         case Reduction::Max:
+            if constexpr( is_ordered_v< Real > ) {
+               if( size == 0 )
+                  throw nb::value_error( "cannot compute the minimum or maximum of an empty expression" );
+               if( reduction == Reduction::Min )
+                  return reduceBlocks< Real >(
+                     std::numeric_limits< Real >::max(),
+                     [ & ]( Real& result, const Real& value )
+                     {
+                        result = TNL::min( result, value );
+                     },
+                     []( const Real& a, const Real& b )
+                     {
+                        return TNL::min( a, b );
+                     } );
+               return reduceBlocks< Real >(
+                  std::numeric_limits< Real >::lowest(),
+                  [ & ]( Real& result, const Real& value )
+                  {
+                     result = TNL::max( result, value );
+                  },
+                  []( const Real& a, const Real& b )
+                  {
+                     return TNL::max( a, b );
+                  } );
+            }
+            else
+               throw nb::type_error( "minimum and maximum are not defined for complex values" );
+         default:
+            throw nb::value_error( "the reduction does not return the value type" );
+      }
+   }
+
+   //! \brief Reduces the expression with a reduction which returns the norm type.
+   [[nodiscard]] NormType
+   reduceNorm( Reduction reduction ) const
+   {
+      switch( reduction ) {
+         case Reduction::AbsSum:
+            return reduceBlocks< NormType >(
+               NormType{ 0 },
+               [ & ]( NormType& result, const Real& value )
+               {
+                  result += std::abs( value );
+               },
+               std::plus<>{} );
+         case Reduction::SquaredAbsSum:
+            return reduceBlocks< NormType >(
+               NormType{ 0 },
+               [ & ]( NormType& result, const Real& value )
+               {
+                  if constexpr( TNL::is_complex_v< Real > )
+                     result += std::norm( value );
+                  else
+                     result += value * value;
+               },
+               std::plus<>{} );
+         case Reduction::AbsMax:
+            return reduceBlocks< NormType >(
+               NormType{ 0 },
+               [ & ]( NormType& result, const Real& value )
+               {
+                  result = TNL::max( result, NormType( std::abs( value ) ) );
+               },
+               []( const NormType& a, const NormType& b )
+               {
+                  return TNL::max( a, b );
+               } );
+         default:
+            throw nb::value_error( "the reduction does not return the norm type" );
+      }
+   }
+
+private:
+   std::vector< Instruction > code;
+   std::vector< ConstViewType > vectors;
+   std::vector< Real > scalars;
+   Index size = 0;
+   std::size_t stackDepth = 0;
+
+   [[nodiscard]] Index
+   getBlocksCount() const
+   {
+      return ( size + blockSize - 1 ) / blockSize;
+   }
+
+   void
+   validate()
+   {
+      std::size_t depth = 0;
+      bool hasVector = false;
+      for( const auto& [ op, operand ] : code ) {
+         if( op == Opcode::Vector || op == Opcode::Scalar ) {
+            const std::size_t count = op == Opcode::Vector ? vectors.size() : scalars.size();
+            if( operand < 0 || static_cast< std::size_t >( operand ) >= count )
+               throw nb::index_error( ( "operand index " + std::to_string( operand ) + " is out-of-bounds" ).c_str() );
+            if( op == Opcode::Vector ) {
+               const Index vectorSize = vectors[ operand ].getSize();
+               if( hasVector && vectorSize != size )
+                  throw nb::value_error( ( "the vectors in the expression have different sizes: " + std::to_string( size )
+                                           + " and " + std::to_string( vectorSize ) )
+                                            .c_str() );
+               size = vectorSize;
+               hasVector = true;
+            }
+            depth++;
+         }
+         else if( is_binary( op ) ) {
+            if( depth < 2 )
+               throw nb::value_error( "invalid expression: missing operand of a binary operation" );
+            if constexpr( ! is_ordered_v< Real > )
+               if( op == Opcode::Min || op == Opcode::Max )
+                  throw nb::type_error( "minimum and maximum are not defined for complex values" );
+            depth--;
+         }
+         else {
+            if( depth < 1 )
+               throw nb::value_error( "invalid expression: missing operand of a unary operation" );
+            if constexpr( ! is_floating_or_complex_v< Real > )
+               if( op != Opcode::Neg && op != Opcode::Abs )
+                  throw nb::type_error( "the function is defined only for floating-point and complex values" );
+         }
+         stackDepth = std::max( stackDepth, depth );
+      }
+      if( depth != 1 )
+         throw nb::value_error( "invalid expression: the program must produce exactly one value" );
+      if( ! hasVector )
+         throw nb::value_error( "invalid expression: there must be at least one vector operand" );
+   }
+
+   /**
+    * \brief Evaluates the program for elements in the range `[begin, end)`.
+    *
+    * Returns a pointer to the results, which is valid until the next call in
+    * the same thread.
+    */
+   [[nodiscard]] const Real*
+   evaluateBlock( Index begin, Index end ) const
+   {
+      // registers for the values on the stack (one block per stack slot)
+      thread_local std::vector< Real > registers;
+      thread_local std::vector< const Real* > stack;
+      registers.resize( stackDepth * blockSize );
+      stack.resize( stackDepth );
+
+      const Index n = end - begin;
+      std::size_t top = 0;
+      for( const auto& [ op, operand ] : code ) {
+         if( op == Opcode::Vector ) {
+            // vectors are read in place, they are not copied into the registers
+            stack[ top++ ] = vectors[ operand ].getData() + begin;
+            continue;
+         }
+         if( op == Opcode::Scalar ) {
+            Real* reg = registers.data() + top * blockSize;
+            for( Index i = 0; i < n; i++ )
+               reg[ i ] = scalars[ operand ];
+            stack[ top++ ] = reg;
+            continue;
+         }
+         if( is_binary( op ) ) {
+            top--;
+            Real* reg = registers.data() + ( top - 1 ) * blockSize;
+            const Real* a = stack[ top - 1 ];
+            const Real* b = stack[ top ];
+            applyBinary( op, a, b, reg, n );
+            stack[ top - 1 ] = reg;
+         }
+         else {
+            Real* reg = registers.data() + ( top - 1 ) * blockSize;
+            applyUnary( op, stack[ top - 1 ], reg, n );
+            stack[ top - 1 ] = reg;
+         }
+      }
+      return stack[ 0 ];
+   }
+
+   static void
+   applyBinary( Opcode op, const Real* a, const Real* b, Real* out, Index n )
+   {
+      switch( op ) {
+         case Opcode::Add:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = a[ i ] + b[ i ];
+            break;
+         case Opcode::Sub:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = a[ i ] - b[ i ];
+            break;
+         case Opcode::Mul:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = a[ i ] * b[ i ];
+            break;
+         case Opcode::Div:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = a[ i ] / b[ i ];
+            break;
+         case Opcode::Min:
+            if constexpr( is_ordered_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = TNL::min( a[ i ], b[ i ] );
+            break;
+         case Opcode::Max:
+            if constexpr( is_ordered_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = TNL::max( a[ i ], b[ i ] );
+            break;
+         default:
+            break;
+      }
+   }
+
+   static void
+   applyUnary( Opcode op, const Real* a, Real* out, Index n )
+   {
+      switch( op ) {
+         case Opcode::Neg:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = -a[ i ];
+            break;
+         case Opcode::Abs:
+            for( Index i = 0; i < n; i++ )
+               out[ i ] = std::abs( a[ i ] );
+            break;
+         case Opcode::Sqrt:
+            if constexpr( is_floating_or_complex_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = std::sqrt( a[ i ] );
+            break;
+         case Opcode::Exp:
+            if constexpr( is_floating_or_complex_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = std::exp( a[ i ] );
+            break;
+         case Opcode::Log:
+            if constexpr( is_floating_or_complex_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = std::log( a[ i ] );
+            break;
+         case Opcode::Sin:
+            if constexpr( is_floating_or_complex_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = std::sin( a[ i ] );
+            break;
+         case Opcode::Cos:
+            if constexpr( is_floating_or_complex_v< Real > )
+               for( Index i = 0; i < n; i++ )
+                  out[ i ] = std::cos( a[ i ] );
+            break;
+         default:
+            break;
+      }
+   }
+
+   /**
+    * \brief Reduces the values of the expression in parallel.
+    *
+    * \param identity The identity element of the reduction.
+    * \param accumulate Adds a value of the expression into a partial result.
+    * \param combine Combines two partial results.
+    */
+   template< typename Result, typename Accumulate, typename Combine >
+   [[nodiscard]] Result
+   reduceBlocks( const Result& identity, Accumulate&& accumulate, Combine&& combine ) const
+   {
+      pytnl::gil_release_for_size release( size );
+      auto fetch = [ & ]( Index block ) -> Result
+      {
+         const Index begin = block * blockSize;
+         const Index end = std::min( begin + blockSize, size );
+         const Real* values = evaluateBlock( begin, end );
+         Result result = identity;
+         for( Index i = 0; i < end - begin; i++ )
+            accumulate( result, values[ i ] );
+         return result;
+      };
+      return TNL::Algorithms::reduce< TNL::Devices::Host >( Index{ 0 }, getBlocksCount(), fetch, combine, identity );
+   }
+};
+
+}  // namespace pytnl::containers::expressions
+
+template< typename VectorType >
+void
+export_expressions( nb::module_& m )
+{
+   using RealType = typename VectorType::RealType;
+   using IndexType = typename VectorType::IndexType;
+   using Program = pytnl::containers::expressions::Program< RealType, IndexType >;
+   using Instruction = typename Program::Instruction;
+   using ConstViewType = typename Program::ConstViewType;
+   using ViewType = typename VectorType::ViewType;
+   using Reduction = pytnl::containers::expressions::Reduction;
+
+   m.def(
+      "_expression_evaluate",
+      []( const std::vector< Instruction >& code,
+          const std::vector< ConstViewType >& vectors,
+          const std::vector< RealType >& scalars,
+          ViewType out )
+      {
+         Program program( code, vectors, scalars );
+         program.evaluate( out );
+      },
+      nb::arg( "code" ),
+      nb::arg( "vectors" ),
+      nb::arg( "scalars" ),
+      nb::arg( "out" ),
+      "Evaluates an expression program into the given vector (internal function used by `pytnl.containers.Expression`)." );
+   m.def(
+      "_expression_evaluate",
+      []( const std::vector< Instruction >& code,
+          const std::vector< ConstViewType >& vectors,
+          const std::vector< RealType >& scalars )
+      {
+         Program program( code, vectors, scalars );
+         VectorType out( program.getSize() );
+         program.evaluate( out.getView() );
+         return out;
+      },
+      nb::arg( "code" ),
+      nb::arg( "vectors" ),
+      nb::arg( "scalars" ),
+      "Evaluates an expression program into a new vector (internal function used by `pytnl.containers.Expression`)." );
+   m.def(
+      "_expression_reduce",
+      []( const std::vector< Instruction >& code,
+          const std::vector< ConstViewType >& vectors,
+          const std::vector< RealType >& scalars,
+          Reduction reduction )
+      {
+         return Program( code, vectors, scalars ).reduce( reduction );
+      },
+      nb::arg( "code" ),
+      nb::arg( "vectors" ),
+      nb::arg( "scalars" ),
+      nb::arg( "reduction" ),
+      "Reduces an expression program (internal function used by `pytnl.containers.Expression`)." );
+   m.def(
+      "_expression_reduce_norm",
+      []( const std::vector< Instruction >& code,
+          const std::vector< ConstViewType >& vectors,
+          const std::vector< RealType >& scalars,
+          Reduction reduction )
+      {
+         return Program( code, vectors, scalars ).reduceNorm( reduction );
+      },
+      nb::arg( "code" ),
+      nb::arg( "vectors" ),
+      nb::arg( "scalars" ),
+      nb::arg( "reduction" ),
+      "Reduces an expression program with a norm-type reduction (internal function used by `pytnl.containers.Expression`)." );
+}
+
+inline void
+export_expression_enums( nb::module_& m )
+{
+   using pytnl::containers::expressions::Opcode;
+   using pytnl::containers::expressions::Reduction;
+
+   nb::enum_< Opcode >( m, "_ExpressionOpcode" )
+      .value( "VECTOR", Opcode::Vector )
+      .value( "SCALAR", Opcode::Scalar )
+      .value( "ADD", Opcode::Add )
+      .value( "SUB", Opcode::Sub )
+      .value( "MUL", Opcode::Mul )
+      .value( "DIV", Opcode::Div )
+      .value( "MIN", Opcode::Min )
+      .value( "MAX", Opcode::Max )
+      .value( "NEG", Opcode::Neg )
+      .value( "ABS", Opcode::Abs )
+      .value( "SQRT", Opcode::Sqrt )
+      .value( "EXP", Opcode::Exp )
+      .value( "LOG", Opcode::Log )
+      .value( "SIN", Opcode::Sin )
+      .value( "COS", Opcode::Cos );
+
+   nb::enum_< Reduction >( m, "_ExpressionReduction" )
+      .value( "SUM", Reduction::Sum )
+      .value( "PRODUCT", Reduction::Product )
+      .value( "MIN", Reduction::Min )
+      .value( "MAX", Reduction::Max )
+      .value( "ABS_SUM", Reduction::AbsSum )
+      .value( "SQUARED_ABS_SUM", Reduction::SquaredAbsSum )
+      .value( "ABS_MAX", Reduction::AbsMax );
+}
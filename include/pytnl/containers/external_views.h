@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/staticFor.h>
+#include <TNL/Devices/Cuda.h>
+#include <TNL/Devices/Host.h>
+
+namespace pytnl::containers {
+
+//! \brief nanobind device constraint corresponding to a TNL device type.
+template< typename Device >
+using ndarray_device_t =
+   std::conditional_t< std::is_same_v< Device, TNL::Devices::Cuda >, nb::device::cuda, nb::device::cpu >;
+
+/**
+ * \brief Type of a C-contiguous nanobind ndarray which can be wrapped in a
+ * view with the given value type (const views accept read-only arrays).
+ */
+template< typename Value, typename Device, std::size_t dim >
+using external_ndarray_t = nb::ndarray< Value, nb::ndim< dim >, nb::c_contig, ndarray_device_t< Device > >;
+
+}  // namespace pytnl::containers
+
+/* Zero-copy constructors of array and vector views from memory owned by other
+ * Python objects (NumPy arrays, memoryviews, or anything supporting DLPack).
+ * The argument is not converted: the dtype, the number of dimensions and the
+ * device must match and the data must be contiguous, otherwise TypeError is
+ * raised. The view keeps the exporting object alive.
+ */
+template< typename ViewType, typename Scope >
+void
+def_external_view_constructor( Scope& scope )
+{
+   using ValueType = typename ViewType::ValueType;
+   using DeviceType = typename ViewType::DeviceType;
+   using IndexType = typename ViewType::IndexType;
+   using ExternalArray = pytnl::containers::external_ndarray_t< ValueType, DeviceType, 1 >;
+
+   // (note that the set of dtypes supported by DLPack is limited)
+   if constexpr( nb::dtype< std::remove_const_t< ValueType > >().bits != 0 ) {
+      scope.def(
+         "__init__",
+         []( ViewType* self, ExternalArray data )
+         {
+            new( self ) ViewType( static_cast< ValueType* >( data.data() ), static_cast< IndexType >( data.shape( 0 ) ) );
+         },
+         nb::arg( "data" ).noconvert(),
+         nb::keep_alive< 1, 2 >(),
+         "Creates a view of the memory of a one-dimensional contiguous array owned by another Python object "
+         "(e.g. a NumPy array or any object supporting DLPack). The data is not copied." );
+   }
+}
+
+/* Zero-copy constructor of NDArrayView from memory owned by other Python
+ * objects. The bound NDArray types use the identity permutation, so only
+ * row-major (C-contiguous) arrays can be wrapped.
+ */
+template< typename ViewType, typename Scope >
+void
+def_external_ndarray_view_constructor( Scope& scope )
+{
+   using ValueType = typename ViewType::ValueType;
+   using DeviceType = typename ViewType::DeviceType;
+   using IndexType = typename ViewType::IndexType;
+   using IndexerType = typename ViewType::IndexerType;
+   constexpr std::size_t dim = ViewType::getDimension();
+   using ExternalArray = pytnl::containers::external_ndarray_t< ValueType, DeviceType, dim >;
+
+   if constexpr( nb::dtype< std::remove_const_t< ValueType > >().bits != 0 ) {
+      scope.def(
+         "__init__",
+         []( ViewType* self, ExternalArray data )
+         {
+            typename IndexerType::SizesHolderType sizes;
+            typename IndexerType::StridesHolderType strides;
+            typename IndexerType::OverlapsType overlaps;
+            TNL::Algorithms::staticFor< std::size_t, 0, dim >(
+               [ & ]( auto i )
+               {
+                  sizes.template setSize< i >( static_cast< IndexType >( data.shape( i ) ) );
+                  // nanobind reports the strides in elements, like TNL
+                  strides.template setSize< i >( static_cast< IndexType >( data.stride( i ) ) );
+                  overlaps.template setSize< i >( 0 );
+               } );
+            new( self ) ViewType( static_cast< ValueType* >( data.data() ), IndexerType( sizes, strides, overlaps ) );
+         },
+         nb::arg( "data" ).noconvert(),
+         nb::keep_alive< 1, 2 >(),
+         "Creates a view of the memory of a C-contiguous array owned by another Python object "
+         "(e.g. a NumPy array or any object supporting DLPack). The data is not copied." );
+   }
+}
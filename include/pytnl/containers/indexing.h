@@ -4,6 +4,8 @@
 #include <pytnl/pytnl.h>
 #include <pytnl/RawIterator.h>
 
+#include "copy_on_write.h"
+
 template< typename Index >
 void
 check_array_index( Index size, Index i )
@@ -85,49 +87,9 @@ def_indexing( Scope& scope )
             throw nb::type_error( "Cannot set element of a read-only array" );
          else {
             check_array_index( a.getSize(), i );
+            pytnl::containers::detach( a );
             // setElement is equivalent to operator[] on host but works on cuda
             a.setElement( i, e );
          }
       } );
 }
-
-template< typename Array, typename Scope >
-void
-def_slice_indexing( Scope& scope )
-{
-   /// Slicing protocol
-   scope.def(
-      "__getitem__",
-      []( const Array& a, nb::slice slice ) -> Array*
-      {
-         auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
-
-         Array* seq = new Array();
-         seq->setSize( slicelength );
-
-         for( std::size_t i = 0; i < slicelength; ++i ) {
-            // setElement/getElement is equivalent to operator[] on host but works on cuda
-            seq->setElement( i, a.getElement( start ) );
-            start += step;
-         }
-         return seq;
-      },
-      "Retrieve list elements using a slice object" );
-
-   scope.def(
-      "__setitem__",
-      []( Array& a, nb::slice slice, const Array& value )
-      {
-         auto [ start, stop, step, slicelength ] = slice.compute( a.getSize() );
-
-         if( slicelength != (std::size_t) value.getSize() )
-            throw std::runtime_error( "Left and right hand size of slice assignment have different sizes!" );
-
-         for( std::size_t i = 0; i < slicelength; ++i ) {
-            // setElement/getElement is equivalent to operator[] on host but works on cuda
-            a.setElement( start, value.getElement( i ) );
-            start += step;
-         }
-      },
-      "Assign list elements using a slice object" );
-}
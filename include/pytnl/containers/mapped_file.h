@@ -0,0 +1,411 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/pytnl.h>
+
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/Vector.h>
+#include <TNL/Devices/Host.h>
+#include <TNL/TypeTraits.h>
+
+namespace pytnl::containers {
+
+//! \brief Modes of file mappings (the same as in `numpy.memmap`).
+enum class MapMode : std::uint8_t
+{
+   ReadOnly,     // "r"
+   ReadWrite,    // "r+"
+   CopyOnWrite,  // "c"
+   Create,       // "w+"
+};
+
+inline MapMode
+parse_map_mode( const std::string& mode )
+{
+   if( mode == "r" )
+      return MapMode::ReadOnly;
+   if( mode == "r+" )
+      return MapMode::ReadWrite;
+   if( mode == "c" )
+      return MapMode::CopyOnWrite;
+   if( mode == "w+" )
+      return MapMode::Create;
+   throw nb::value_error( ( "mode must be 'r', 'r+', 'c' or 'w+', got '" + mode + "'" ).c_str() );
+}
+
+//! \brief Raises `OSError` for the current `errno` and the given file name.
+[[noreturn]] inline void
+raise_os_error( const std::string& filename )
+{
+   PyErr_SetFromErrnoWithFilename( PyExc_OSError, filename.c_str() );
+   throw nb::python_error();
+}
+
+/**
+ * \brief RAII wrapper for a memory mapping of a whole file.
+ *
+ * The pages are loaded lazily by the operating system, so the file may be
+ * larger than the available memory. In the `Create` mode, the file is created
+ * (or truncated) and resized to `createSize` bytes (without writing anything,
+ * so it is a sparse file on most file systems).
+ */
+class MappedFile
+{
+public:
+   MappedFile( const std::string& filename, MapMode mode, std::size_t createSize = 0 )
+   {
+      const bool writable = mode == MapMode::ReadWrite || mode == MapMode::Create;
+      int flags = writable ? O_RDWR : O_RDONLY;
+      if( mode == MapMode::Create )
+         flags |= O_CREAT | O_TRUNC;
+      const int fd = ::open( filename.c_str(), flags, 0666 );
+      if( fd < 0 )
+         raise_os_error( filename );
+
+      if( mode == MapMode::Create && ::ftruncate( fd, static_cast< off_t >( createSize ) ) != 0 ) {
+         const int error = errno;
+         ::close( fd );
+         errno = error;
+         raise_os_error( filename );
+      }
+
+      struct stat info{};
+      if( ::fstat( fd, &info ) != 0 ) {
+         const int error = errno;
+         ::close( fd );
+         errno = error;
+         raise_os_error( filename );
+      }
+      length = static_cast< std::size_t >( info.st_size );
+
+      // empty files cannot be mapped
+      if( length > 0 ) {
+         const int prot = mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+         const int share = mode == MapMode::CopyOnWrite ? MAP_PRIVATE : MAP_SHARED;
+         address = ::mmap( nullptr, length, prot, share, fd, 0 );
+         if( address == MAP_FAILED ) {
+            const int error = errno;
+            address = nullptr;
+            ::close( fd );
+            errno = error;
+            raise_os_error( filename );
+         }
+      }
+      // the mapping remains valid after closing the file descriptor
+      ::close( fd );
+   }
+
+   MappedFile( const MappedFile& ) = delete;
+   MappedFile&
+   operator=( const MappedFile& ) = delete;
+
+   ~MappedFile()
+   {
+      if( address != nullptr )
+         ::munmap( address, length );
+   }
+
+   [[nodiscard]] char*
+   getData() const
+   {
+      return static_cast< char* >( address );
+   }
+
+   [[nodiscard]] std::size_t
+   getSize() const
+   {
+      return length;
+   }
+
+private:
+   void* address = nullptr;
+   std::size_t length = 0;
+};
+
+/* Aligned array file format (written by `save( filename, aligned=True )`):
+ *
+ *    magic number "PYTNLA01"
+ *    length of the serialization type (64-bit), serialization type (characters)
+ *    number of elements (64-bit)
+ *    zero padding up to the next multiple of `mapped_alignment` bytes
+ *    elements
+ *
+ * TNL files have no padding, so their data start at an offset which depends
+ * on the length of the serialization type and is generally not aligned for
+ * 8- or 16-byte elements. The aligned files can always be mapped in place.
+ */
+constexpr char aligned_magic[] = "PYTNLA01";
+constexpr std::size_t mapped_alignment = 64;
+
+//! \brief Returns the offset of the elements in an aligned file with the given serialization type.
+inline std::size_t
+aligned_data_offset( const std::string& type )
+{
+   const std::size_t header = sizeof( aligned_magic ) - 1 + sizeof( std::uint64_t ) + type.size() + sizeof( std::uint64_t );
+   return ( header + mapped_alignment - 1 ) / mapped_alignment * mapped_alignment;
+}
+
+//! \brief Checks if the file starts with the magic number of the aligned format.
+inline bool
+is_aligned_file( const std::string& filename )
+{
+   std::ifstream file( filename, std::ios::binary );
+   char fileMagic[ sizeof( aligned_magic ) - 1 ];
+   return file.read( fileMagic, sizeof( fileMagic ) ) && std::memcmp( fileMagic, aligned_magic, sizeof( fileMagic ) ) == 0;
+}
+
+/**
+ * \brief Writes `size` elements of `data` to a file in the aligned format.
+ *
+ * Does not need the GIL, errors are reported by `std::runtime_error`.
+ */
+template< typename Value, typename Index >
+void
+write_aligned_array( const std::string& filename, const Value* data, Index size )
+{
+   const std::string type = TNL::Containers::Array< Value, TNL::Devices::Host, Index >::getSerializationType();
+   const std::uint64_t typeLength = type.size();
+   const std::uint64_t count = size;
+   const std::size_t header = sizeof( aligned_magic ) - 1 + sizeof( typeLength ) + type.size() + sizeof( count );
+   const std::string padding( aligned_data_offset( type ) - header, '\0' );
+
+   std::ofstream file( filename, std::ios::binary | std::ios::trunc );
+   if( ! file )
+      throw std::runtime_error( "failed to open the file '" + filename + "' for writing" );
+   file.write( aligned_magic, sizeof( aligned_magic ) - 1 );
+   file.write( reinterpret_cast< const char* >( &typeLength ), sizeof( typeLength ) );
+   file.write( type.data(), static_cast< std::streamsize >( type.size() ) );
+   file.write( reinterpret_cast< const char* >( &count ), sizeof( count ) );
+   file.write( padding.data(), static_cast< std::streamsize >( padding.size() ) );
+   if( size > 0 )
+      file.write( reinterpret_cast< const char* >( data ), static_cast< std::streamsize >( count * sizeof( Value ) ) );
+   if( ! file )
+      throw std::runtime_error( "failed to write the file '" + filename + "'" );
+}
+
+/**
+ * \brief Reads the header of a file written by `Array.save` or `Vector.save`.
+ *
+ * Both the TNL format and the aligned format are accepted. The header of
+ * a TNL file consists of the TNL magic number, the serialization type (as
+ * a length-prefixed string) and the size of the array, the elements follow.
+ * Returns the offset of the first element and sets `size`.
+ */
+template< typename Value, typename Index >
+std::size_t
+read_array_header( const std::string& filename, Index& size )
+{
+   std::ifstream file( filename, std::ios::binary );
+   if( ! file )
+      raise_os_error( filename );
+
+   std::string type;
+   std::size_t offset = 0;
+   if( is_aligned_file( filename ) ) {
+      std::uint64_t typeLength = 0;
+      std::uint64_t count = 0;
+      file.seekg( sizeof( aligned_magic ) - 1 );
+      if( ! file.read( reinterpret_cast< char* >( &typeLength ), sizeof( typeLength ) ) || typeLength > 1024 )
+         throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+      type.resize( typeLength );
+      if( ! file.read( type.data(), static_cast< std::streamsize >( typeLength ) )
+          || ! file.read( reinterpret_cast< char* >( &count ), sizeof( count ) )
+          || count > static_cast< std::uint64_t >( std::numeric_limits< Index >::max() ) )
+         throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+      size = static_cast< Index >( count );
+      offset = aligned_data_offset( type );
+   }
+   else {
+      constexpr char magic[] = "TNLMN";
+      char fileMagic[ sizeof( magic ) - 1 ];
+      int typeLength = 0;
+      if( ! file.read( fileMagic, sizeof( fileMagic ) ) || std::memcmp( fileMagic, magic, sizeof( fileMagic ) ) != 0
+          || ! file.read( reinterpret_cast< char* >( &typeLength ), sizeof( typeLength ) ) || typeLength < 0 )
+         throw nb::value_error( ( "the file '" + filename + "' is not a TNL file" ).c_str() );
+
+      type.resize( static_cast< std::size_t >( typeLength ) );
+      if( ! file.read( type.data(), typeLength ) || ! file.read( reinterpret_cast< char* >( &size ), sizeof( size ) )
+          || size < 0 )
+         throw nb::value_error( ( "the file '" + filename + "' is truncated" ).c_str() );
+      offset = sizeof( fileMagic ) + sizeof( typeLength ) + type.size() + sizeof( size );
+   }
+
+   // both arrays and vectors can be mapped
+   if( type != TNL::Containers::Array< Value, TNL::Devices::Host, Index >::getSerializationType()
+       && type != TNL::Containers::Vector< Value, TNL::Devices::Host, Index >::getSerializationType() )
+      throw nb::value_error( ( "the file '" + filename + "' contains an object of type '" + type
+                               + "', expected: "
+                               + TNL::Containers::Array< Value, TNL::Devices::Host, Index >::getSerializationType() )
+                                .c_str() );
+
+   return offset;
+}
+
+/**
+ * \brief Loads `array` (an array or a view of the right size) from a file in
+ * the aligned format.
+ *
+ * The header is read with the GIL held, the GIL is released for reading the
+ * elements.
+ */
+template< typename ArrayType >
+void
+load_aligned_array( ArrayType& array, const std::string& filename )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using IndexType = typename ArrayType::IndexType;
+
+   IndexType size = 0;
+   const std::size_t offset = read_array_header< ValueType >( filename, size );
+   nb::gil_scoped_release release;
+   std::ifstream file( filename, std::ios::binary );
+   file.seekg( static_cast< std::streamoff >( offset ) );
+   auto read = [ & ]( ValueType* data )
+   {
+      if( size > 0
+          && ! file.read( reinterpret_cast< char* >( data ),
+                          static_cast< std::streamsize >( static_cast< std::size_t >( size ) * sizeof( ValueType ) ) ) )
+         throw std::runtime_error( "the file '" + filename + "' is truncated" );
+   };
+   if constexpr( TNL::IsViewType< ArrayType >::value ) {
+      // views cannot be resized, like in TNL
+      if( size != array.getSize() )
+         throw std::runtime_error( "the size of the array in the file '" + filename + "' does not match the size of the view" );
+   }
+   else
+      array.setSize( size );
+   if constexpr( std::is_same_v< typename ArrayType::DeviceType, TNL::Devices::Host > ) {
+      read( array.getData() );
+   }
+   else {
+      TNL::Containers::Array< ValueType, TNL::Devices::Host, IndexType > host( size );
+      read( host.getData() );
+      array = host.getConstView();
+   }
+}
+
+/**
+ * \brief Returns a Python object of the view of `size` elements at `offset`
+ * bytes in the mapping (e.g. \ref MappedFile), which keeps the mapping alive.
+ */
+template< typename ViewType, typename Mapping >
+nb::typed< nb::object, ViewType >
+make_mapped_view( std::unique_ptr< Mapping > mapping, std::size_t offset, typename ViewType::IndexType size )
+{
+   using ValueType = typename ViewType::ValueType;
+
+   char* data = size > 0 ? mapping->getData() + offset : nullptr;
+   if( reinterpret_cast< std::uintptr_t >( data ) % alignof( ValueType ) != 0 )
+      throw nb::value_error( ( "the data at offset " + std::to_string( offset ) + " are not aligned to "
+                               + std::to_string( alignof( ValueType ) ) + " bytes, so they cannot be mapped in place" )
+                                .c_str() );
+
+   // the capsule takes the ownership of the mapping
+   nb::capsule owner( mapping.release(),
+                      []( void* p ) noexcept
+                      {
+                         delete static_cast< Mapping* >( p );
+                      } );
+   nb::object result = nb::cast( ViewType( reinterpret_cast< ValueType* >( data ), size ) );
+   nb::detail::keep_alive( result.ptr(), owner.ptr() );
+   return nb::borrow< nb::typed< nb::object, ViewType > >( result );
+}
+
+}  // namespace pytnl::containers
+
+/* File-backed array and vector views on the host. The files are mapped into
+ * memory with mmap, so the data are read lazily by the operating system and
+ * can be larger than the available memory. Since TNL arrays always own their
+ * (heap) allocation, mapped data can be accessed only through views. The
+ * constant views accept only the "r" mode, the other views accept "r+"
+ * (writes go to the file), "c" (copy-on-write, the file is not modified) and
+ * "w+" (a new file is created, only in `mapFile`).
+ */
+template< typename ViewType, typename Scope >
+void
+def_mapped_file( Scope& scope )
+{
+   using ValueType = typename ViewType::ValueType;
+   using IndexType = typename ViewType::IndexType;
+   using MapMode = pytnl::containers::MapMode;
+
+   auto check_mode = []( MapMode mode, bool allowCreate )
+   {
+      if constexpr( std::is_const_v< ValueType > ) {
+         if( mode != MapMode::ReadOnly )
+            throw nb::value_error( "constant views can be mapped only in the 'r' mode" );
+      }
+      else {
+         if( mode == MapMode::ReadOnly )
+            throw nb::value_error( "read-only mappings require a constant view type" );
+         if( mode == MapMode::Create && ! allowCreate )
+            throw nb::value_error( "the 'w+' mode can be used only in mapFile" );
+      }
+   };
+
+   scope
+      .def_static(
+         "loadMapped",
+         [ check_mode ]( const std::string& filename, const std::string& modeName )
+         {
+            const MapMode mode = pytnl::containers::parse_map_mode( modeName );
+            check_mode( mode, false );
+            IndexType size = 0;
+            const std::size_t offset =
+               pytnl::containers::read_array_header< std::remove_const_t< ValueType > >( filename, size );
+            auto mapping = std::make_unique< pytnl::containers::MappedFile >( filename, mode );
+            if( mapping->getSize() != offset + static_cast< std::size_t >( size ) * sizeof( ValueType ) )
+               throw nb::value_error(
+                  ( "the size of the file '" + filename + "' does not match the array size in its header" ).c_str() );
+            return pytnl::containers::make_mapped_view< ViewType >( std::move( mapping ), offset, size );
+         },
+         nb::arg( "filename" ),
+         nb::arg( "mode" ) = std::is_const_v< ValueType > ? "r" : "c",
+         "Maps the data of a file written by `save` into memory and returns a view of them.\n\n"
+         "The data are not read until they are accessed. The file must not be modified by "
+         "other programs while it is mapped. Files written by `save( filename, aligned=True )` "
+         "can always be mapped, the data in plain TNL files may not be aligned for the element type." )
+      .def_static(
+         "mapFile",
+         [ check_mode ]( const std::string& filename, IndexType size, const std::string& modeName, std::size_t offset )
+         {
+            const MapMode mode = pytnl::containers::parse_map_mode( modeName );
+            check_mode( mode, true );
+            if( mode == MapMode::Create && size < 0 )
+               throw nb::value_error( "the size must be specified in the 'w+' mode" );
+            const std::size_t bytes = size < 0 ? 0 : static_cast< std::size_t >( size ) * sizeof( ValueType );
+            auto mapping = std::make_unique< pytnl::containers::MappedFile >( filename, mode, offset + bytes );
+            if( mapping->getSize() < offset + bytes )
+               throw nb::value_error( ( "the file '" + filename + "' is too small for the requested size" ).c_str() );
+            if( size < 0 ) {
+               const std::size_t available = mapping->getSize() - offset;
+               if( available % sizeof( ValueType ) != 0 )
+                  throw nb::value_error(
+                     ( "the size of the file '" + filename + "' is not a multiple of the element size" ).c_str() );
+               size = static_cast< IndexType >( available / sizeof( ValueType ) );
+            }
+            return pytnl::containers::make_mapped_view< ViewType >( std::move( mapping ), offset, size );
+         },
+         nb::arg( "filename" ),
+         nb::arg( "size" ) = -1,
+         nb::arg( "mode" ) = std::is_const_v< ValueType > ? "r" : "r+",
+         nb::arg( "offset" ) = 0,
+         "Maps raw binary data (without any header) of a file into memory and returns a view of them.\n\n"
+         "`size` is the number of elements, by default it is determined from the size of the file. "
+         "In the 'w+' mode, a new file of the given size is created, its pages are allocated lazily "
+         "when they are written. The data must be aligned to the size of the elements." );
+}
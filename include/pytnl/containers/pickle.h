@@ -0,0 +1,189 @@
+#pragma once
+
+#include <Python.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/staticFor.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/ArrayView.h>
+#include <TNL/Devices/Host.h>
+
+#include "buffer_protocol.h"
+#include "conversion.h"
+
+namespace pytnl::containers::pickle {
+
+/**
+ * \brief Returns the pickled state of the elements of a view.
+ *
+ * With pickle protocol 5, host data are exposed through `pickle.PickleBuffer`
+ * (i.e. without any copy, the pickler may even transfer them out-of-band),
+ * the buffer keeps `owner` alive. Otherwise, or for data on GPUs and value
+ * types without a buffer format (bfloat16), the state is a `bytes` object
+ * with a copy of the elements.
+ */
+template< typename View >
+nb::object
+pickle_view( const View& view, nb::handle owner, int protocol )
+{
+   using Value = std::remove_const_t< typename View::ValueType >;
+   // the exporter must be a registered type, so it uses ::IndexType even for
+   // views with a different index type (e.g. 32-bit sparse matrix indices)
+   using Index = ::IndexType;
+   using HostConstView = TNL::Containers::ArrayView< const Value, TNL::Devices::Host, Index >;
+   const std::size_t bytes = static_cast< std::size_t >( view.getSize() ) * sizeof( Value );
+
+   if constexpr( std::is_same_v< typename View::DeviceType, TNL::Devices::Host > ) {
+      // PickleBuffer requests the format, which bfloat16 does not have
+      if( protocol >= 5 && buffer_protocol::pybuffer_format< Value >() != nullptr ) {
+         nb::object exporter = nb::cast( HostConstView( view.getData(), view.getSize() ) );
+         nb::detail::keep_alive( exporter.ptr(), owner.ptr() );
+         nb::object buffer = nb::steal( PyPickleBuffer_FromObject( exporter.ptr() ) );
+         if( ! buffer.is_valid() )
+            throw nb::python_error();
+         return buffer;
+      }
+      return nb::bytes( view.getData(), bytes );
+   }
+   else {
+      pytnl::Array< Value, TNL::Devices::Host, Index > host;
+      {
+         pytnl::gil_release_for_size release( view.getSize() );
+         host = view;
+      }
+      return nb::bytes( host.getData(), bytes );
+   }
+}
+
+//! \brief Returns the number of elements of type `Value` in the pickled state.
+template< typename Value >
+std::size_t
+pickled_size( nb::handle state )
+{
+   conversion::BufferView buffer( state.ptr(), PyBUF_SIMPLE );
+   if( buffer.view.len % static_cast< Py_ssize_t >( sizeof( Value ) ) != 0 )
+      throw nb::value_error( "the size of the pickled data is not a multiple of the element size" );
+   return static_cast< std::size_t >( buffer.view.len ) / sizeof( Value );
+}
+
+/**
+ * \brief Copies the pickled state (any contiguous buffer, e.g. `bytes` or an
+ * out-of-band buffer) into a view, which must have the same size in bytes.
+ */
+template< typename View >
+void
+unpickle_view( View view, nb::handle state )
+{
+   using Value = std::remove_const_t< typename View::ValueType >;
+   using Index = typename View::IndexType;
+
+   conversion::BufferView buffer( state.ptr(), PyBUF_SIMPLE );
+   if( buffer.view.len != static_cast< Py_ssize_t >( view.getSize() * sizeof( Value ) ) )
+      throw nb::value_error( ( "the pickled data have " + std::to_string( buffer.view.len ) + " bytes, expected "
+                               + std::to_string( view.getSize() * sizeof( Value ) ) )
+                                .c_str() );
+   TNL::Containers::ArrayView< const Value, TNL::Devices::Host, Index > source( static_cast< const Value* >( buffer.view.buf ),
+                                                                               view.getSize() );
+   pytnl::gil_release_for_size release( view.getSize() );
+   view = source;
+}
+
+}  // namespace pytnl::containers::pickle
+
+/* Pickle support for arrays and vectors. The state is the raw data of the
+ * array, so unpickling is a single copy (or a transfer from the GPU) without
+ * any per-element work. With protocol 5, the data are passed to the pickler
+ * as a `PickleBuffer`, so they can be sent out-of-band without copying (e.g.
+ * by `multiprocessing` or Dask). Vectors inherit these methods from arrays.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_pickle( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+
+   array
+      .def(
+         "__reduce_ex__",
+         []( nb::handle self, int protocol )
+         {
+            const ArrayType& a = nb::cast< const ArrayType& >( self );
+            return nb::make_tuple(
+               self.type(), nb::tuple(), pytnl::containers::pickle::pickle_view( a.getConstView(), self, protocol ) );
+         },
+         nb::arg( "protocol" ),
+         nb::sig( "def __reduce_ex__(self, protocol: typing.SupportsIndex, /) -> tuple[typing.Any, ...]" ) )
+      .def(
+         "__setstate__",
+         []( ArrayType* self, nb::handle state )
+         {
+            // `self` is not constructed yet, the array is built in a local first
+            ArrayType array;
+            array.setSize( pytnl::containers::pickle::pickled_size< ValueType >( state ) );
+            pytnl::containers::pickle::unpickle_view( array.getView(), state );
+            new( self ) ArrayType( std::move( array ) );
+         },
+         nb::arg( "state" ),
+         nb::sig( "def __setstate__(self, state: collections.abc.Buffer, /) -> None" ) );
+}
+
+/* Pickle support for N-dimensional arrays, the state is a tuple of the sizes
+ * and the raw data of the storage array.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_ndarray_pickle( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using IndexType = typename ArrayType::IndexType;
+   constexpr std::size_t dim = ArrayType::getDimension();
+
+   array
+      .def(
+         "__reduce_ex__",
+         []( nb::handle self, int protocol )
+         {
+            const ArrayType& a = nb::cast< const ArrayType& >( self );
+            std::array< IndexType, dim > sizes;
+            IndexType size = 1;
+            TNL::Algorithms::staticFor< std::size_t, 0, dim >(
+               [ & ]( auto i )
+               {
+                  sizes[ i ] = a.template getSize< i >();
+                  size *= sizes[ i ];
+               } );
+            if( size != a.getStorageSize() )
+               throw nb::value_error( "arrays with overlaps cannot be pickled" );
+            TNL::Containers::ArrayView< const ValueType, typename ArrayType::DeviceType, IndexType > storage( a.getData(), size );
+            nb::object data = pytnl::containers::pickle::pickle_view( storage, self, protocol );
+            return nb::make_tuple( self.type(), nb::tuple(), nb::make_tuple( nb::cast( sizes ), data ) );
+         },
+         nb::arg( "protocol" ),
+         nb::sig( "def __reduce_ex__(self, protocol: typing.SupportsIndex, /) -> tuple[typing.Any, ...]" ) )
+      .def(
+         "__setstate__",
+         []( ArrayType* self, const std::tuple< std::array< IndexType, dim >, nb::handle >& state )
+         {
+            // `self` is not constructed yet, the array is built in a local first
+            ArrayType array;
+            std::apply(
+               [ & ]( auto... sizes )
+               {
+                  array.setSizes( sizes... );
+               },
+               std::get< 0 >( state ) );
+            pytnl::containers::pickle::unpickle_view( array.getStorageArrayView(), std::get< 1 >( state ) );
+            new( self ) ArrayType( std::move( array ) );
+         },
+         nb::arg( "state" ),
+         nb::sig( "def __setstate__(self, state: tuple[tuple[int, ...], collections.abc.Buffer], /) -> None" ) );
+}
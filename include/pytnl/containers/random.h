@@ -0,0 +1,180 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/half.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/parallelFor.h>
+#include <TNL/Devices/Host.h>
+
+#include "copy_on_write.h"
+
+namespace pytnl::containers::random {
+
+/* Counter-based random number generation (Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3", SC'11). The element `i` of an array is
+ * computed from the Philox4x32-10 bijection of the counter `offset + i` under
+ * the key given by the seed, so the elements can be generated in any order
+ * and the result does not depend on the number of threads. Consecutive
+ * fills of the same stream can use disjoint ranges of counters by passing
+ * the `offset`.
+ */
+
+struct Philox4x32
+{
+   std::uint32_t x[ 4 ];
+};
+
+inline void
+mulhilo( std::uint32_t a, std::uint32_t b, std::uint32_t& hi, std::uint32_t& lo )
+{
+   const std::uint64_t product = std::uint64_t( a ) * b;
+   hi = std::uint32_t( product >> 32 );
+   lo = std::uint32_t( product );
+}
+
+//! \brief Philox4x32 with 10 rounds, as in the Random123 library.
+inline Philox4x32
+philox4x32( std::uint64_t counter, std::uint64_t seed )
+{
+   constexpr std::uint32_t multiplier0 = 0xD2511F53u;
+   constexpr std::uint32_t multiplier1 = 0xCD9E8D57u;
+   constexpr std::uint32_t weyl0 = 0x9E3779B9u;
+   constexpr std::uint32_t weyl1 = 0xBB67AE85u;
+
+   std::uint32_t c[ 4 ] = { std::uint32_t( counter ), std::uint32_t( counter >> 32 ), 0, 0 };
+   std::uint32_t k0 = std::uint32_t( seed );
+   std::uint32_t k1 = std::uint32_t( seed >> 32 );
+   for( int round = 0; round < 10; round++ ) {
+      if( round > 0 ) {
+         k0 += weyl0;
+         k1 += weyl1;
+      }
+      std::uint32_t hi0;
+      std::uint32_t lo0;
+      std::uint32_t hi1;
+      std::uint32_t lo1;
+      mulhilo( multiplier0, c[ 0 ], hi0, lo0 );
+      mulhilo( multiplier1, c[ 2 ], hi1, lo1 );
+      const std::uint32_t next[ 4 ] = { hi1 ^ c[ 1 ] ^ k0, lo1, hi0 ^ c[ 3 ] ^ k1, lo0 };
+      for( int j = 0; j < 4; j++ )
+         c[ j ] = next[ j ];
+   }
+   return { { c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] } };
+}
+
+//! \brief Converts random bits to a uniform number in `[0, 1)` with all bits of the mantissa random.
+template< typename Real >
+Real
+to_unit( std::uint32_t hi, std::uint32_t lo )
+{
+   if constexpr( std::is_same_v< Real, float > )
+      return float( hi >> 8 ) * 0x1p-24f;
+   else
+      return Real( ( std::uint64_t( hi ) << 21 ) | ( lo >> 11 ) ) * Real( 0x1p-53 );
+}
+
+//! \brief Fills `view` with uniformly distributed numbers in `[low, high)`.
+template< typename View >
+void
+fill_uniform( const View& view, std::uint64_t seed, double low, double high, std::uint64_t offset )
+{
+   using ValueType = std::remove_const_t< typename View::ValueType >;
+   using IndexType = typename View::IndexType;
+   using Real = pytnl::compute_type_t< ValueType >;
+
+   ValueType* data = view.getData();
+   const Real a = Real( low );
+   const Real scale = Real( high - low );
+   TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                       view.getSize(),
+                                                       [ = ]( IndexType i ) mutable
+                                                       {
+                                                          const auto r = philox4x32( offset + std::uint64_t( i ), seed );
+                                                          data[ i ] = ValueType( a + scale * to_unit< Real >( r.x[ 0 ], r.x[ 1 ] ) );
+                                                       } );
+}
+
+//! \brief Fills `view` with normally distributed numbers (Box-Muller transform of two uniform numbers).
+template< typename View >
+void
+fill_normal( const View& view, std::uint64_t seed, double mean, double stddev, std::uint64_t offset )
+{
+   using ValueType = std::remove_const_t< typename View::ValueType >;
+   using IndexType = typename View::IndexType;
+   using Real = pytnl::compute_type_t< ValueType >;
+
+   ValueType* data = view.getData();
+   const Real mu = Real( mean );
+   const Real sigma = Real( stddev );
+   TNL::Algorithms::parallelFor< TNL::Devices::Host >( IndexType{ 0 },
+                                                       view.getSize(),
+                                                       [ = ]( IndexType i ) mutable
+                                                       {
+                                                          const auto r = philox4x32( offset + std::uint64_t( i ), seed );
+                                                          // 1 - u is in (0, 1], so the logarithm is finite
+                                                          const Real u1 = Real( 1 ) - to_unit< Real >( r.x[ 0 ], r.x[ 1 ] );
+                                                          const Real u2 = to_unit< Real >( r.x[ 2 ], r.x[ 3 ] );
+                                                          const Real radius = std::sqrt( Real( -2 ) * std::log( u1 ) );
+                                                          const Real angle = Real( 6.283185307179586 ) * u2;
+                                                          data[ i ] = ValueType( mu + sigma * radius * std::cos( angle ) );
+                                                       } );
+}
+
+}  // namespace pytnl::containers::random
+
+/* Random fills of host arrays with a floating-point value type. The argument
+ * `getView` returns a contiguous view of the elements (e.g. the storage array
+ * of an NDArray, which is filled in the order of the storage).
+ */
+template< typename ArrayType, typename GetView, typename... Args >
+void
+def_random_fill( nb::class_< ArrayType, Args... >& array, GetView getView )
+{
+   static_assert( ! std::is_const_v< typename ArrayType::ValueType > );
+
+   array
+      .def(
+         "setRandomUniform",
+         [ getView ]( ArrayType& self, std::uint64_t seed, double low, double high, std::uint64_t offset )
+         {
+            if( ! ( low < high ) )
+               throw nb::value_error( "low must be less than high" );
+            pytnl::containers::detach( self );
+            const auto view = getView( self );
+            pytnl::gil_release_for_size release( view.getSize() );
+            pytnl::containers::random::fill_uniform( view, seed, low, high, offset );
+         },
+         nb::arg( "seed" ),
+         nb::arg( "low" ) = 0.0,
+         nb::arg( "high" ) = 1.0,
+         nb::arg( "offset" ) = 0,
+         "Fills the array with uniformly distributed random numbers in `[low, high)`.\n\n"
+         "The numbers are generated in parallel by the counter-based Philox4x32-10 generator: the element "
+         "`i` depends only on `seed` and the counter `offset + i`, so the result is reproducible regardless "
+         "of the number of threads. Use different offsets (e.g. the number of elements generated so far) "
+         "to continue the same stream of numbers. Note that the rounding to single or half precision may "
+         "produce `high`." )
+      .def(
+         "setRandomNormal",
+         [ getView ]( ArrayType& self, std::uint64_t seed, double mean, double stddev, std::uint64_t offset )
+         {
+            if( ! ( stddev >= 0 ) )
+               throw nb::value_error( "stddev must be non-negative" );
+            pytnl::containers::detach( self );
+            const auto view = getView( self );
+            pytnl::gil_release_for_size release( view.getSize() );
+            pytnl::containers::random::fill_normal( view, seed, mean, stddev, offset );
+         },
+         nb::arg( "seed" ),
+         nb::arg( "mean" ) = 0.0,
+         nb::arg( "stddev" ) = 1.0,
+         nb::arg( "offset" ) = 0,
+         "Fills the array with normally distributed random numbers.\n\n"
+         "The numbers are generated by the counter-based generator as in `setRandomUniform` (with the same "
+         "rules for `seed` and `offset`) and transformed by the Box-Muller method." );
+}
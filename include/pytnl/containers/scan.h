@@ -0,0 +1,282 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/scan.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/ArrayView.h>
+#include <TNL/Devices/Host.h>
+#include <TNL/Functional.h>
+#include <TNL/TypeTraits.h>
+
+#include "indexing.h"
+
+namespace pytnl::containers {
+
+//! \brief Built-in associative operations which can be used in scans.
+enum class ScanOperation : std::uint8_t
+{
+   Plus,
+   Max,
+   Min,
+   LogicalOr,
+};
+
+/**
+ * \brief Calls `f` with the TNL functional corresponding to `op`.
+ *
+ * Operations which do not make sense for the value type (e.g. `Max` for
+ * complex numbers or `Plus` for bool) raise `ValueError`.
+ */
+template< typename Value, typename Function >
+void
+dispatch_scan_operation( ScanOperation op, Function&& f )
+{
+   switch( op ) {
+      case ScanOperation::Plus:
+         if constexpr( ! std::is_same_v< Value, bool > ) {
+            f( TNL::Plus{} );
+            return;
+         }
+         break;
+      case ScanOperation::Max:
+         if constexpr( ! TNL::is_complex_v< Value > ) {
+            f( TNL::Max{} );
+            return;
+         }
+         break;
+      case ScanOperation::Min:
+         if constexpr( ! TNL::is_complex_v< Value > ) {
+            f( TNL::Min{} );
+            return;
+         }
+         break;
+      case ScanOperation::LogicalOr:
+         if constexpr( std::is_integral_v< Value > ) {
+            f( TNL::LogicalOr{} );
+            return;
+         }
+         break;
+   }
+   throw nb::value_error( "the scan operation is not supported for arrays of this value type" );
+}
+
+/**
+ * \brief Segmented scan of the elements `[begin, end)` of a host array view.
+ *
+ * `flags[i]` marks the first element of a segment, the scan restarts from
+ * the identity at each segment. The range is split into one chunk per thread:
+ * the chunks are scanned independently, then the carries between the chunks
+ * are computed sequentially and finally added to the leading elements of each
+ * chunk (up to its first flag). TNL provides only a sequential segmented scan
+ * on the host.
+ */
+template< bool Inclusive, typename View, typename FlagsView, typename Reduction >
+void
+segmented_scan( const View& v,
+                const FlagsView& flags,
+                typename View::IndexType begin,
+                typename View::IndexType end,
+                Reduction&& reduction,
+                typename View::ValueType identity )
+{
+   using Value = typename View::ValueType;
+   using Index = typename View::IndexType;
+
+   // the chunks must be large enough to amortize the fix-up phase
+   constexpr Index minChunkSize = 1 << 14;
+   const Index size = end - begin;
+   const Index chunks = std::max( Index{ 1 }, std::min( Index( TNL::Devices::Host::getMaxThreadsCount() ), size / minChunkSize ) );
+   const Index chunkSize = ( size + chunks - 1 ) / chunks;
+
+   TNL::Containers::Array< Value, TNL::Devices::Host, Index > totals( chunks );
+   TNL::Containers::Array< bool, TNL::Devices::Host, Index > flagged( chunks );
+   Value* data = v.getData();
+
+   // phase 1: independent scans of the chunks
+#ifdef HAVE_OPENMP
+   #pragma omp parallel for if( TNL::Devices::Host::isOMPEnabled() && chunks > 1 )
+#endif
+   for( Index c = 0; c < chunks; c++ ) {
+      const Index chunkBegin = begin + c * chunkSize;
+      const Index chunkEnd = std::min( chunkBegin + chunkSize, end );
+      Value result = identity;
+      bool hasFlag = false;
+      for( Index i = chunkBegin; i < chunkEnd; i++ ) {
+         if( flags[ i ] ) {
+            result = identity;
+            hasFlag = true;
+         }
+         if constexpr( Inclusive ) {
+            result = reduction( result, data[ i ] );
+            data[ i ] = result;
+         }
+         else {
+            const Value x = data[ i ];
+            data[ i ] = result;
+            result = reduction( result, x );
+         }
+      }
+      totals[ c ] = result;
+      flagged[ c ] = hasFlag;
+   }
+
+   // phase 2: carries from the open segments at the ends of the chunks
+   Value carry = identity;
+   for( Index c = 0; c < chunks; c++ ) {
+      const Value total = totals[ c ];
+      totals[ c ] = carry;
+      carry = flagged[ c ] ? total : reduction( carry, total );
+   }
+
+   // phase 3: add the carries to the elements preceding the first flag in each chunk
+#ifdef HAVE_OPENMP
+   #pragma omp parallel for if( TNL::Devices::Host::isOMPEnabled() && chunks > 1 )
+#endif
+   for( Index c = 1; c < chunks; c++ ) {
+      const Index chunkBegin = begin + c * chunkSize;
+      const Index chunkEnd = std::min( chunkBegin + chunkSize, end );
+      for( Index i = chunkBegin; i < chunkEnd && ! flags[ i ]; i++ )
+         data[ i ] = reduction( totals[ c ], data[ i ] );
+   }
+}
+
+}  // namespace pytnl::containers
+
+inline void
+export_scan_operation( nb::module_& m )
+{
+   using pytnl::containers::ScanOperation;
+   nb::enum_< ScanOperation >( m, "ScanOperation", "Associative operations for prefix sums (scans)." )
+      .value( "PLUS", ScanOperation::Plus )
+      .value( "MAX", ScanOperation::Max )
+      .value( "MIN", ScanOperation::Min )
+      .value( "LOGICAL_OR", ScanOperation::LogicalOr );
+}
+
+/* In-place prefix sums (scans) of arrays, vectors and their non-constant
+ * views. The plain scans are the parallel scans of TNL (multi-threaded on the
+ * host, when OpenMP is enabled), the segmented scans are available only on
+ * the host.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_scans( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+   using ScanOperation = pytnl::containers::ScanOperation;
+   using FlagsType = TNL::Containers::ArrayView< const bool, DeviceType, IndexType >;
+
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      array
+         .def(
+            "inplaceInclusiveScan",
+            []( ArrayType& self, IndexType begin, IndexType end, ScanOperation operation )
+            {
+               check_array_range( self.getSize(), begin, end );
+               pytnl::containers::detach( self );
+               if( end == 0 )
+                  end = self.getSize();
+               pytnl::containers::dispatch_scan_operation< ValueType >( operation,
+                                                                        [ & ]( auto reduction )
+                                                                        {
+                                                                           pytnl::gil_release_for_size release( end - begin );
+                                                                           TNL::Algorithms::inplaceInclusiveScan( self, begin, end, reduction );
+                                                                        } );
+            },
+            nb::arg( "begin" ) = 0,
+            nb::arg( "end" ) = 0,
+            nb::arg( "operation" ) = ScanOperation::Plus,
+            "Computes the inclusive prefix sum (scan) of the elements `[begin, end)` in-place.\n\n"
+            "The element `i` is replaced with `op(a[begin], ..., a[i])`. `end = 0` means the end of the array." )
+         .def(
+            "inplaceExclusiveScan",
+            []( ArrayType& self, IndexType begin, IndexType end, ScanOperation operation )
+            {
+               check_array_range( self.getSize(), begin, end );
+               pytnl::containers::detach( self );
+               if( end == 0 )
+                  end = self.getSize();
+               pytnl::containers::dispatch_scan_operation< ValueType >( operation,
+                                                                        [ & ]( auto reduction )
+                                                                        {
+                                                                           pytnl::gil_release_for_size release( end - begin );
+                                                                           TNL::Algorithms::inplaceExclusiveScan( self, begin, end, reduction );
+                                                                        } );
+            },
+            nb::arg( "begin" ) = 0,
+            nb::arg( "end" ) = 0,
+            nb::arg( "operation" ) = ScanOperation::Plus,
+            "Computes the exclusive prefix sum (scan) of the elements `[begin, end)` in-place.\n\n"
+            "The element `i` is replaced with `op(a[begin], ..., a[i-1])`, the first element is replaced with the "
+            "identity of the operation. `end = 0` means the end of the array." );
+
+      if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+         array
+            .def(
+               "inplaceInclusiveSegmentedScan",
+               []( ArrayType& self, const FlagsType& flags, IndexType begin, IndexType end, ScanOperation operation )
+               {
+                  check_array_range( self.getSize(), begin, end );
+                  pytnl::containers::detach( self );
+                  if( end == 0 )
+                     end = self.getSize();
+                  if( flags.getSize() != self.getSize() )
+                     throw nb::value_error( ( "the flags array must have the same size as the array ("
+                                              + std::to_string( self.getSize() ) + "), got " + std::to_string( flags.getSize() ) )
+                                               .c_str() );
+                  pytnl::containers::dispatch_scan_operation< ValueType >(
+                     operation,
+                     [ & ]( auto reduction )
+                     {
+                        using Reduction = decltype( reduction );
+                        pytnl::gil_release_for_size release( end - begin );
+                        pytnl::containers::segmented_scan< true >(
+                           self.getView(), flags, begin, end, reduction, Reduction::template getIdentity< ValueType >() );
+                     } );
+               },
+               nb::arg( "flags" ),
+               nb::arg( "begin" ) = 0,
+               nb::arg( "end" ) = 0,
+               nb::arg( "operation" ) = ScanOperation::Plus,
+               "Computes the inclusive scan of each segment of the elements `[begin, end)` in-place.\n\n"
+               "`flags` is a boolean array of the same size as the array, `flags[i]` marks the first element of a segment." )
+            .def(
+               "inplaceExclusiveSegmentedScan",
+               []( ArrayType& self, const FlagsType& flags, IndexType begin, IndexType end, ScanOperation operation )
+               {
+                  check_array_range( self.getSize(), begin, end );
+                  pytnl::containers::detach( self );
+                  if( end == 0 )
+                     end = self.getSize();
+                  if( flags.getSize() != self.getSize() )
+                     throw nb::value_error( ( "the flags array must have the same size as the array ("
+                                              + std::to_string( self.getSize() ) + "), got " + std::to_string( flags.getSize() ) )
+                                               .c_str() );
+                  pytnl::containers::dispatch_scan_operation< ValueType >(
+                     operation,
+                     [ & ]( auto reduction )
+                     {
+                        using Reduction = decltype( reduction );
+                        pytnl::gil_release_for_size release( end - begin );
+                        pytnl::containers::segmented_scan< false >(
+                           self.getView(), flags, begin, end, reduction, Reduction::template getIdentity< ValueType >() );
+                     } );
+               },
+               nb::arg( "flags" ),
+               nb::arg( "begin" ) = 0,
+               nb::arg( "end" ) = 0,
+               nb::arg( "operation" ) = ScanOperation::Plus,
+               "Computes the exclusive scan of each segment of the elements `[begin, end)` in-place.\n\n"
+               "`flags` is a boolean array of the same size as the array, `flags[i]` marks the first element of a segment." );
+      }
+   }
+}
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <pytnl/pytnl.h>
+
+#include <TNL/Containers/Array.h>
+#include <TNL/Devices/Host.h>
+
+#include "mapped_file.h"
+
+namespace pytnl::containers {
+
+/**
+ * \brief Header at the beginning of a shared memory object created by
+ * \ref SharedMemory.
+ *
+ * The type hash and size are checked when another process attaches the
+ * object. The reference count is the number of live mappings in all
+ * processes, the last one removes the name of the object.
+ */
+struct SharedMemoryHeader
+{
+   static constexpr char magicValue[ 8 ] = "PyTNLsh";
+
+   char magic[ 8 ];
+   std::uint64_t typeHash;
+   std::int64_t size;
+   std::atomic< std::int64_t > references;
+};
+
+// the elements start at a cache line boundary
+constexpr std::size_t sharedMemoryHeaderSize = 64;
+static_assert( sizeof( SharedMemoryHeader ) <= sharedMemoryHeaderSize );
+// atomics are address-free (and thus usable across processes) only when they are lock-free
+static_assert( std::atomic< std::int64_t >::is_always_lock_free );
+
+//! \brief FNV-1a hash of a type name, used to check the element type of shared memory objects.
+inline std::uint64_t
+type_name_hash( const std::string& name )
+{
+   std::uint64_t hash = 0xcbf29ce484222325u;
+   for( const char c : name ) {
+      hash ^= static_cast< unsigned char >( c );
+      hash *= 0x100000001b3u;
+   }
+   return hash;
+}
+
+//! \brief Returns the POSIX name of a shared memory object (with a single leading slash).
+inline std::string
+shared_memory_name( const std::string& name )
+{
+   const std::string result = ! name.empty() && name[ 0 ] == '/' ? name : "/" + name;
+   if( result.size() < 2 || result.find( '/', 1 ) != std::string::npos )
+      throw nb::value_error( ( "invalid shared memory name '" + name + "' (it must not be empty or contain slashes)" ).c_str() );
+   return result;
+}
+
+/**
+ * \brief RAII wrapper for a mapping of a POSIX shared memory object
+ * (`shm_open`) holding an array of elements preceded by \ref SharedMemoryHeader.
+ *
+ * All processes which created or attached the same name map the same
+ * physical pages, so writes are immediately visible to the other processes
+ * (the synchronization is up to the caller). The object is removed
+ * (`shm_unlink`) when the last mapping is destroyed; processes killed
+ * without running the destructors leave the object behind, it can be
+ * removed by \ref unlink.
+ */
+class SharedMemory
+{
+public:
+   //! \brief Creates a new zero-initialized object. Fails if the name already exists.
+   [[nodiscard]] static std::unique_ptr< SharedMemory >
+   create( const std::string& name, std::uint64_t typeHash, std::int64_t size, std::size_t elementSize )
+   {
+      const std::string posixName = shared_memory_name( name );
+      const int fd = ::shm_open( posixName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+      if( fd < 0 )
+         raise_os_error( name );
+
+      std::unique_ptr< SharedMemory > result( new SharedMemory( posixName ) );
+      const std::size_t length = sharedMemoryHeaderSize + static_cast< std::size_t >( size ) * elementSize;
+      // ftruncate fills the object with zeros
+      if( ::ftruncate( fd, static_cast< off_t >( length ) ) != 0 || ! result->map( fd, length ) ) {
+         const int error = errno;
+         ::close( fd );
+         ::shm_unlink( posixName.c_str() );
+         errno = error;
+         raise_os_error( name );
+      }
+      ::close( fd );
+
+      SharedMemoryHeader* header = new( result->address ) SharedMemoryHeader{};
+      std::memcpy( header->magic, SharedMemoryHeader::magicValue, sizeof( header->magic ) );
+      header->typeHash = typeHash;
+      header->size = size;
+      header->references.store( 1 );
+      result->attached = true;
+      return result;
+   }
+
+   //! \brief Maps an existing object created by \ref create with the same type hash.
+   [[nodiscard]] static std::unique_ptr< SharedMemory >
+   attach( const std::string& name, std::uint64_t typeHash, std::size_t elementSize )
+   {
+      const std::string posixName = shared_memory_name( name );
+      const int fd = ::shm_open( posixName.c_str(), O_RDWR, 0 );
+      if( fd < 0 )
+         raise_os_error( name );
+
+      std::unique_ptr< SharedMemory > result( new SharedMemory( posixName ) );
+      struct stat info{};
+      if( ::fstat( fd, &info ) != 0 ) {
+         const int error = errno;
+         ::close( fd );
+         errno = error;
+         raise_os_error( name );
+      }
+      const std::size_t length = static_cast< std::size_t >( info.st_size );
+      if( length < sharedMemoryHeaderSize ) {
+         ::close( fd );
+         throw nb::value_error( ( "the shared memory object '" + name + "' was not created by PyTNL" ).c_str() );
+      }
+      if( ! result->map( fd, length ) ) {
+         const int error = errno;
+         ::close( fd );
+         errno = error;
+         raise_os_error( name );
+      }
+      ::close( fd );
+
+      SharedMemoryHeader* header = result->getHeader();
+      if( std::memcmp( header->magic, SharedMemoryHeader::magicValue, sizeof( header->magic ) ) != 0 )
+         throw nb::value_error( ( "the shared memory object '" + name + "' was not created by PyTNL" ).c_str() );
+      if( header->typeHash != typeHash )
+         throw nb::value_error( ( "the shared memory object '" + name + "' contains elements of a different type" ).c_str() );
+      if( length != sharedMemoryHeaderSize + static_cast< std::size_t >( header->size ) * elementSize )
+         throw nb::value_error( ( "the size of the shared memory object '" + name + "' does not match its header" ).c_str() );
+
+      // the object is being removed when the count has already dropped to zero
+      std::int64_t count = header->references.load();
+      do {
+         if( count <= 0 ) {
+            errno = ENOENT;
+            raise_os_error( name );
+         }
+      } while( ! header->references.compare_exchange_weak( count, count + 1 ) );
+      result->attached = true;
+      return result;
+   }
+
+   //! \brief Removes the name of an object (the existing mappings remain valid).
+   static void
+   unlink( const std::string& name )
+   {
+      if( ::shm_unlink( shared_memory_name( name ).c_str() ) != 0 )
+         raise_os_error( name );
+   }
+
+   SharedMemory( const SharedMemory& ) = delete;
+   SharedMemory&
+   operator=( const SharedMemory& ) = delete;
+
+   ~SharedMemory()
+   {
+      if( address == nullptr )
+         return;
+      // objects which failed the checks in attach were not counted
+      if( attached && getHeader()->references.fetch_sub( 1 ) == 1 && isLinked() )
+         ::shm_unlink( name.c_str() );
+      ::munmap( address, length );
+   }
+
+   [[nodiscard]] SharedMemoryHeader*
+   getHeader() const
+   {
+      return static_cast< SharedMemoryHeader* >( address );
+   }
+
+   [[nodiscard]] char*
+   getData() const
+   {
+      return static_cast< char* >( address );
+   }
+
+   [[nodiscard]] std::int64_t
+   getElementCount() const
+   {
+      return getHeader()->size;
+   }
+
+private:
+   explicit SharedMemory( std::string name )
+   : name( std::move( name ) )
+   {}
+
+   bool
+   map( int fd, std::size_t bytes )
+   {
+      struct stat info{};
+      if( ::fstat( fd, &info ) != 0 )
+         return false;
+      void* result = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+      if( result == MAP_FAILED )
+         return false;
+      address = result;
+      length = bytes;
+      device = info.st_dev;
+      inode = info.st_ino;
+      return true;
+   }
+
+   //! \brief Checks if the name still refers to the mapped object (it may have been unlinked and reused).
+   [[nodiscard]] bool
+   isLinked() const
+   {
+      const int fd = ::shm_open( name.c_str(), O_RDONLY, 0 );
+      if( fd < 0 )
+         return false;
+      struct stat info{};
+      const bool same = ::fstat( fd, &info ) == 0 && info.st_dev == device && info.st_ino == inode;
+      ::close( fd );
+      return same;
+   }
+
+   std::string name;
+   void* address = nullptr;
+   std::size_t length = 0;
+   dev_t device = 0;
+   ino_t inode = 0;
+   bool attached = false;
+};
+
+}  // namespace pytnl::containers
+
+/* Array and vector views of POSIX shared memory on the host, for sharing data
+ * between processes on the same node without copying. As with the mapped
+ * files, TNL arrays always own their (heap) allocation, so shared memory can
+ * be accessed only through views. Each mapping is released when the view (and
+ * all views derived from it) is garbage-collected, and the shared memory
+ * object is removed when the last process releases its mapping.
+ */
+template< typename ViewType, typename Scope >
+void
+def_shared_memory( Scope& scope )
+{
+   using ValueType = typename ViewType::ValueType;
+   using IndexType = typename ViewType::IndexType;
+   using SharedMemory = pytnl::containers::SharedMemory;
+
+   auto type_hash = []()
+   {
+      return pytnl::containers::type_name_hash(
+         TNL::Containers::Array< std::remove_const_t< ValueType >, TNL::Devices::Host, IndexType >::getSerializationType() );
+   };
+
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      scope.def_static(
+         "createShared",
+         [ type_hash ]( const std::string& name, IndexType size )
+         {
+            if( size < 0 )
+               throw nb::value_error( ( "size must be non-negative, got " + std::to_string( size ) ).c_str() );
+            auto mapping = SharedMemory::create( name, type_hash(), size, sizeof( ValueType ) );
+            return pytnl::containers::make_mapped_view< ViewType >(
+               std::move( mapping ), pytnl::containers::sharedMemoryHeaderSize, size );
+         },
+         nb::arg( "name" ),
+         nb::arg( "size" ),
+         "Creates a named POSIX shared memory object with `size` zero-initialized elements and returns a view "
+         "of them.\n\n"
+         "Other processes on the same node can map the same memory with `attachShared`. Raises "
+         "`FileExistsError` if the name is already used." );
+   }
+
+   scope
+      .def_static(
+         "attachShared",
+         [ type_hash ]( const std::string& name )
+         {
+            auto mapping = SharedMemory::attach( name, type_hash(), sizeof( ValueType ) );
+            const auto size = static_cast< IndexType >( mapping->getElementCount() );
+            return pytnl::containers::make_mapped_view< ViewType >(
+               std::move( mapping ), pytnl::containers::sharedMemoryHeaderSize, size );
+         },
+         nb::arg( "name" ),
+         "Maps a shared memory object created by `createShared` (in any process) and returns a view of it.\n\n"
+         "The value type must be the same as in `createShared`. The object is removed when the views in all "
+         "processes have been released." )
+      .def_static(
+         "unlinkShared",
+         []( const std::string& name )
+         {
+            SharedMemory::unlink( name );
+         },
+         nb::arg( "name" ),
+         "Removes the name of a shared memory object, e.g. one left behind by a process that was killed.\n\n"
+         "Existing views remain valid, but the object cannot be attached anymore." );
+}
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include <TNL/Algorithms/parallelFor.h>
+#include <TNL/Algorithms/sort.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/Vector.h>
+#include <TNL/Devices/Host.h>
+
+#include "copy_on_write.h"
+
+namespace pytnl::containers {
+
+/**
+ * \brief Parallel merge sort of the range `[first, last)` on the host.
+ *
+ * The default host sorter of TNL is std::sort, which runs in one thread.
+ * Here the range is split into one chunk per thread, the chunks are sorted
+ * in parallel and then merged pairwise. The merges are stable, so the whole
+ * sort is stable if `Stable` is true.
+ */
+template< bool Stable, typename Iterator, typename Compare >
+void
+parallel_sort( Iterator first, Iterator last, Compare compare )
+{
+   using Index = std::ptrdiff_t;
+
+   // the chunks must be large enough to amortize the merges
+   constexpr Index minChunkSize = 1 << 14;
+   const Index size = last - first;
+   Index chunks = 1;
+   if( TNL::Devices::Host::isOMPEnabled() )
+      chunks = std::max( Index{ 1 }, std::min( Index( TNL::Devices::Host::getMaxThreadsCount() ), size / minChunkSize ) );
+   const Index chunkSize = ( size + chunks - 1 ) / chunks;
+
+#ifdef HAVE_OPENMP
+   #pragma omp parallel for if( chunks > 1 )
+#endif
+   for( Index c = 0; c < chunks; c++ ) {
+      Iterator chunkBegin = first + std::min( c * chunkSize, size );
+      Iterator chunkEnd = first + std::min( ( c + 1 ) * chunkSize, size );
+      if constexpr( Stable )
+         std::stable_sort( chunkBegin, chunkEnd, compare );
+      else
+         std::sort( chunkBegin, chunkEnd, compare );
+   }
+
+   for( Index width = chunkSize; width < size; width *= 2 ) {
+      const Index merges = ( size + 2 * width - 1 ) / ( 2 * width );
+#ifdef HAVE_OPENMP
+   #pragma omp parallel for if( merges > 1 )
+#endif
+      for( Index m = 0; m < merges; m++ ) {
+         const Index begin = m * 2 * width;
+         const Index middle = std::min( begin + width, size );
+         const Index end = std::min( begin + 2 * width, size );
+         std::inplace_merge( first + begin, first + middle, first + end, compare );
+      }
+   }
+}
+
+/**
+ * \brief Strict weak order of values in ascending or descending order, which
+ * puts NaNs last in both orders.
+ *
+ * The plain `<` is not a strict weak order when NaNs are present (a NaN is
+ * equivalent to every other value), so the sorts would be undefined.
+ */
+template< typename Value, bool Descending >
+struct NanLastCompare
+{
+   __cuda_callable__
+   bool
+   operator()( const Value& a, const Value& b ) const
+   {
+      // only NaNs are not equal to themselves
+      if( b != b )
+         return a == a;
+      if( a != a )
+         return false;
+      if constexpr( Descending )
+         return b < a;
+      else
+         return a < b;
+   }
+};
+
+//! \brief Sorts the elements of an array view in ascending or descending order (NaNs are placed last).
+template< typename View >
+void
+sort_values( const View& view, bool descending )
+{
+   using Value = typename View::ValueType;
+   if constexpr( std::is_same_v< typename View::DeviceType, TNL::Devices::Host > ) {
+      if( descending )
+         parallel_sort< false >( view.getData(), view.getData() + view.getSize(), NanLastCompare< Value, true >{} );
+      else
+         parallel_sort< false >( view.getData(), view.getData() + view.getSize(), NanLastCompare< Value, false >{} );
+   }
+   else {
+      auto v = view;
+      if( descending )
+         TNL::Algorithms::sort( v, NanLastCompare< Value, true >{} );
+      else
+         TNL::Algorithms::sort( v, NanLastCompare< Value, false >{} );
+   }
+}
+
+/**
+ * \brief Returns the permutation which sorts the given keys.
+ *
+ * The sort is stable on the host. On GPUs, the TNL in-place sorter (bitonic
+ * sort) is used, which is not stable. NaN keys are placed last.
+ */
+template< typename KeysView >
+pytnl::Vector< typename KeysView::IndexType, typename KeysView::DeviceType, typename KeysView::IndexType >
+argsort( const KeysView& keys, bool descending )
+{
+   using Key = std::remove_const_t< typename KeysView::ValueType >;
+   using Device = typename KeysView::DeviceType;
+   using Index = typename KeysView::IndexType;
+
+   pytnl::Vector< Index, Device, Index > permutation( keys.getSize() );
+   permutation.forAllElements(
+      [] __cuda_callable__( Index i, Index& value )
+      {
+         value = i;
+      } );
+
+   if constexpr( std::is_same_v< Device, TNL::Devices::Host > ) {
+      const Key* k = keys.getData();
+      Index* begin = permutation.getData();
+      if( descending )
+         parallel_sort< true >( begin,
+                                begin + keys.getSize(),
+                                [ k ]( Index a, Index b )
+                                {
+                                   return NanLastCompare< Key, true >{}( k[ a ], k[ b ] );
+                                } );
+      else
+         parallel_sort< true >( begin,
+                                begin + keys.getSize(),
+                                [ k ]( Index a, Index b )
+                                {
+                                   return NanLastCompare< Key, false >{}( k[ a ], k[ b ] );
+                                } );
+   }
+   else {
+      // sort a copy of the keys together with the permutation
+      pytnl::Array< Key, Device, Index > sortedKeys;
+      sortedKeys = keys;
+      Key* k = sortedKeys.getData();
+      Index* p = permutation.getData();
+      auto swap = [ = ] __cuda_callable__( Index a, Index b ) mutable
+      {
+         TNL::swap( k[ a ], k[ b ] );
+         TNL::swap( p[ a ], p[ b ] );
+      };
+      if( descending )
+         TNL::Algorithms::sort< Device, Index >( 0,
+                                                 keys.getSize(),
+                                                 [ = ] __cuda_callable__( Index a, Index b )
+                                                 {
+                                                    return NanLastCompare< Key, true >{}( k[ a ], k[ b ] );
+                                                 },
+                                                 swap );
+      else
+         TNL::Algorithms::sort< Device, Index >( 0,
+                                                 keys.getSize(),
+                                                 [ = ] __cuda_callable__( Index a, Index b )
+                                                 {
+                                                    return NanLastCompare< Key, false >{}( k[ a ], k[ b ] );
+                                                 },
+                                                 swap );
+   }
+   return permutation;
+}
+
+//! \brief Reorders the elements of `view` so that `view[i] = old_view[permutation[i]]`.
+template< typename View, typename PermutationView >
+void
+permute( const View& view, const PermutationView& permutation )
+{
+   using Value = typename View::ValueType;
+   using Device = typename View::DeviceType;
+   using Index = typename View::IndexType;
+
+   pytnl::Array< Value, Device, Index > copy;
+   copy = view;
+   const Value* in = copy.getData();
+   Value* out = view.getData();
+   const Index* p = permutation.getData();
+   TNL::Algorithms::parallelFor< Device >( Index{ 0 },
+                                           view.getSize(),
+                                           [ = ] __cuda_callable__( Index i ) mutable
+                                           {
+                                              out[ i ] = in[ p[ i ] ];
+                                           } );
+}
+
+/**
+ * \brief Vectorized binary search: `result[i]` is the index where `values[i]`
+ * would be inserted into `sorted` to keep it sorted (in ascending order).
+ *
+ * With `right = false`, the first suitable index is returned (i.e. the index
+ * of the first element not less than the value), otherwise the last one.
+ * The order is the order of `sort_values`, i.e. NaNs are sorted last.
+ */
+template< typename SortedView, typename ValuesView, typename ResultView >
+void
+search_sorted( const SortedView& sorted, const ValuesView& values, const ResultView& result, bool right )
+{
+   using Device = typename SortedView::DeviceType;
+   using Index = typename SortedView::IndexType;
+   using Value = std::remove_const_t< typename SortedView::ValueType >;
+   using Compare = NanLastCompare< Value, false >;
+
+   const auto* a = sorted.getData();
+   const Index n = sorted.getSize();
+   const auto* v = values.getData();
+   Index* r = result.getData();
+   TNL::Algorithms::parallelFor< Device >( Index{ 0 },
+                                           values.getSize(),
+                                           [ = ] __cuda_callable__( Index i ) mutable
+                                           {
+                                              const Value x = v[ i ];
+                                              const Compare less{};
+                                              Index lo = 0;
+                                              Index hi = n;
+                                              while( lo < hi ) {
+                                                 const Index mid = lo + ( hi - lo ) / 2;
+                                                 if( right ? ! less( x, a[ mid ] ) : less( a[ mid ], x ) )
+                                                    lo = mid + 1;
+                                                 else
+                                                    hi = mid;
+                                              }
+                                              r[ i ] = lo;
+                                           } );
+}
+
+}  // namespace pytnl::containers
+
+inline bool
+parse_search_side( const std::string& side )
+{
+   if( side == "left" )
+      return false;
+   if( side == "right" )
+      return true;
+   throw nb::value_error( ( "side must be 'left' or 'right', got '" + side + "'" ).c_str() );
+}
+
+template< typename Index >
+void
+check_sort_key_sizes( Index size, Index keys_size )
+{
+   if( size != keys_size )
+      throw nb::value_error( ( "the keys must have the same size as the array (" + std::to_string( size ) + "), got "
+                               + std::to_string( keys_size ) )
+                                .c_str() );
+}
+
+/* Sorting and searching methods of arrays, vectors and their views. Only
+ * real (ordered) arrays can be sorted, but any non-constant array can be
+ * reordered by a sort of a key array. On the host, the sorts are parallel
+ * merge sorts implemented in PyTNL, on GPUs the TNL sorters are used.
+ */
+template< typename ArrayType, typename... Args >
+void
+def_sorting( nb::class_< ArrayType, Args... >& array )
+{
+   using ValueType = typename ArrayType::ValueType;
+   using DeviceType = typename ArrayType::DeviceType;
+   using IndexType = typename ArrayType::IndexType;
+   using ConstViewType = typename ArrayType::ConstViewType;
+   using PermutationType = pytnl::Vector< IndexType, DeviceType, IndexType >;
+   constexpr bool is_ordered =
+      std::is_arithmetic_v< std::remove_const_t< ValueType > > && ! std::is_same_v< std::remove_const_t< ValueType >, bool >;
+
+   if constexpr( is_ordered ) {
+      array
+         .def(
+            "argsort",
+            []( const ArrayType& self, bool descending )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return pytnl::containers::argsort( self.getConstView(), descending );
+            },
+            nb::kw_only(),
+            nb::arg( "descending" ) = false,
+            "Returns the permutation (`Vector_int`) which sorts the array.\n\n"
+            "The sort is stable on the host, but not on GPUs. NaNs are sorted last in both orders." )
+         .def(
+            "searchsorted",
+            []( const ArrayType& self, const ConstViewType& values, const std::string& side )
+            {
+               const bool right = parse_search_side( side );
+               pytnl::gil_release_for_size release( values.getSize() );
+               PermutationType result( values.getSize() );
+               pytnl::containers::search_sorted( self.getConstView(), values, result.getView(), right );
+               return result;
+            },
+            nb::arg( "values" ),
+            nb::arg( "side" ) = "left",
+            "Finds the indices where the values should be inserted to keep the (ascending) array sorted.\n\n"
+            "With `side='left'`, the first suitable index is returned for each value, with `side='right'`, the last one." );
+
+      if constexpr( std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+         array.def(
+            "searchsorted",
+            []( const ArrayType& self, std::remove_const_t< ValueType > value, const std::string& side ) -> IndexType
+            {
+               using Compare = pytnl::containers::NanLastCompare< std::remove_const_t< ValueType >, false >;
+               const auto* begin = self.getData();
+               const auto* end = begin + self.getSize();
+               if( parse_search_side( side ) )
+                  return std::upper_bound( begin, end, value, Compare{} ) - begin;
+               return std::lower_bound( begin, end, value, Compare{} ) - begin;
+            },
+            nb::arg( "value" ),
+            nb::arg( "side" ) = "left" );
+      }
+   }
+
+   if constexpr( is_ordered && ! std::is_const_v< ValueType > ) {
+      array
+         .def(
+            "ascendingSort",
+            []( ArrayType& self )
+            {
+               pytnl::containers::detach( self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               pytnl::containers::sort_values( self.getView(), false );
+            },
+            "Sorts the elements in ascending order in-place, NaNs are placed at the end." )
+         .def(
+            "descendingSort",
+            []( ArrayType& self )
+            {
+               pytnl::containers::detach( self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               pytnl::containers::sort_values( self.getView(), true );
+            },
+            "Sorts the elements in descending order in-place, NaNs are placed at the end." );
+   }
+
+   if constexpr( ! std::is_const_v< ValueType > ) {
+      // keys can be integer or floating-point arrays (the bound types with the same device)
+      auto def_sort_by_key = [ &array ]( auto key_tag )
+      {
+         using KeyType = decltype( key_tag );
+         using KeysViewType = TNL::Containers::ArrayView< KeyType, DeviceType, IndexType >;
+         array.def(
+            "sortByKey",
+            []( ArrayType& self, const KeysViewType& keys, bool descending )
+            {
+               check_sort_key_sizes( self.getSize(), keys.getSize() );
+               // the permutation would be applied twice to keys which share the data with the array
+               const auto* keysBegin = reinterpret_cast< const char* >( keys.getData() );
+               const auto* keysEnd = keysBegin + keys.getSize() * sizeof( KeyType );
+               const auto* selfBegin = reinterpret_cast< const char* >( self.getData() );
+               const auto* selfEnd = selfBegin + self.getSize() * sizeof( ValueType );
+               if( keysBegin < selfEnd && selfBegin < keysEnd ) {
+                  if constexpr( std::is_same_v< KeyType, ValueType > ) {
+                     if( keysBegin == selfBegin ) {
+                        // sorting by itself is just a sort
+                        pytnl::containers::detach( self );
+                        pytnl::gil_release_for_size release( self.getSize() );
+                        pytnl::containers::sort_values( self.getView(), descending );
+                        return;
+                     }
+                  }
+                  throw nb::value_error( "the keys must not overlap the array (except for the array itself)" );
+               }
+               pytnl::containers::detach( self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               const auto permutation = pytnl::containers::argsort( keys, descending );
+               pytnl::containers::permute( keys, permutation.getConstView() );
+               pytnl::containers::permute( self.getView(), permutation.getConstView() );
+            },
+            nb::arg( "keys" ),
+            nb::kw_only(),
+            nb::arg( "descending" ) = false,
+            "Sorts the array by the given keys in-place, the keys are sorted as well.\n\n"
+            "The keys must be an array of the same size with the value type `int`, `float`, `int32` or "
+            "`float32`, they must not overlap the array, except for the array itself "
+            "(`a.sortByKey(a)` is equivalent to sorting `a`). "
+            "The sort is stable on the host, but not on GPUs. NaN keys are sorted last in both orders." );
+      };
+      def_sort_by_key( ::IndexType{} );
+      def_sort_by_key( ::RealType{} );
+      def_sort_by_key( ::Index32Type{} );
+      def_sort_by_key( ::Float32Type{} );
+   }
+}
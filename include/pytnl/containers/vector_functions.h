@@ -0,0 +1,232 @@
+#pragma once
+
+#include <TNL/TypeTraits.h>
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include "vector_operators.h"
+
+/* Module functions writing the result of an element-wise operation into an
+ * existing vector given by the keyword-only `out` argument, which can be
+ * a Vector or a VectorView. Unlike the operators, they do not allocate the
+ * result, so they can be used in loops without any allocations.
+ */
+template< typename VectorType >
+void
+def_vector_functions( nb::module_& m )
+{
+   using RealType = typename VectorType::RealType;
+   using ViewType = typename VectorType::ViewType;
+   using ConstViewType = typename VectorType::ConstViewType;
+
+   if constexpr( TNL::IsScalarType< RealType >::value ) {
+      m  //
+         .def(
+            "add",
+            []( ConstViewType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), b.getSize(), "b" );
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a + b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = a + b` element-wise." )
+         .def(
+            "add",
+            []( ConstViewType a, RealType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a + b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+         .def(
+            "add",
+            []( RealType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( b.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a + b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+
+         .def(
+            "sub",
+            []( ConstViewType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), b.getSize(), "b" );
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a - b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = a - b` element-wise." )
+         .def(
+            "sub",
+            []( ConstViewType a, RealType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a - b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+         .def(
+            "sub",
+            []( RealType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( b.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a - b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+
+         .def(
+            "mul",
+            []( ConstViewType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), b.getSize(), "b" );
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a * b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = a * b` element-wise." )
+         .def(
+            "mul",
+            []( ConstViewType a, RealType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a * b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+         .def(
+            "mul",
+            []( RealType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( b.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a * b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+
+         .def(
+            "div",
+            []( ConstViewType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), b.getSize(), "b" );
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a / b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = a / b` element-wise." )
+         .def(
+            "div",
+            []( ConstViewType a, RealType b, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a / b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+         .def(
+            "div",
+            []( RealType a, ConstViewType b, ViewType out )
+            {
+               check_vector_sizes( b.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = a / b;
+            },
+            nb::arg( "a" ),
+            nb::arg( "b" ),
+            nb::kw_only(),
+            nb::arg( "out" ) )
+
+         .def(
+            "neg",
+            []( ConstViewType a, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = -a;
+            },
+            nb::arg( "a" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = -a` element-wise." )
+         .def(
+            "abs",
+            []( ConstViewType a, ViewType out )
+            {
+               check_vector_sizes( a.getSize(), out.getSize(), "out" );
+               pytnl::gil_release_for_size release( out.getSize() );
+               out = TNL::abs( a );
+            },
+            nb::arg( "a" ),
+            nb::kw_only(),
+            nb::arg( "out" ),
+            "Computes `out = abs(a)` element-wise." )
+
+         // BLAS-like updates (the output vector is also an input)
+         .def(
+            "axpy",
+            []( RealType alpha, ConstViewType x, ViewType y )
+            {
+               check_vector_sizes( x.getSize(), y.getSize(), "y" );
+               pytnl::gil_release_for_size release( y.getSize() );
+               y += alpha * x;
+            },
+            nb::arg( "alpha" ),
+            nb::arg( "x" ),
+            nb::arg( "y" ),
+            "Computes `y = alpha * x + y` in-place." )
+         .def(
+            "axpby",
+            []( RealType alpha, ConstViewType x, RealType beta, ViewType y )
+            {
+               check_vector_sizes( x.getSize(), y.getSize(), "y" );
+               pytnl::gil_release_for_size release( y.getSize() );
+               y = alpha * x + beta * y;
+            },
+            nb::arg( "alpha" ),
+            nb::arg( "x" ),
+            nb::arg( "beta" ),
+            nb::arg( "y" ),
+            "Computes `y = alpha * x + beta * y` in-place." );
+   }
+}
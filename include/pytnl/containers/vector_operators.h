@@ -1,28 +1,58 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <TNL/TypeTraits.h>
+#include <TNL/Containers/Vector.h>
+#include <pytnl/gil.h>
 #include <pytnl/pytnl.h>
 
+#include "copy_on_write.h"
+
+template< typename Index >
+void
+check_vector_sizes( Index expected, Index size, const char* name )
+{
+   if( size != expected )
+      throw nb::value_error( ( "size mismatch: the vector '" + std::string( name ) + "' has size " + std::to_string( size )
+                               + ", but the expected size is " + std::to_string( expected ) )
+                                .c_str() );
+}
+
+/* Defines the operators for vectors as well as vector views. The other operand
+ * of binary operators is taken as a const view, so any vector or vector view
+ * with the same value type can be used. Results of the out-of-place operators
+ * are always new (owning) vectors, in-place operators write to the memory of
+ * the left operand (which is not possible for const views).
+ */
 template< typename VectorType, typename... Args >
 void
 def_vector_operators( nb::class_< VectorType, Args... >& vector )
 {
-   using RealType = typename VectorType::RealType;
+   using RealType = std::remove_const_t< typename VectorType::RealType >;
+   using DeviceType = typename VectorType::DeviceType;
+   using IndexType = typename VectorType::IndexType;
+   using ConstViewType = typename VectorType::ConstViewType;
+   using ResultType = pytnl::Vector< RealType, DeviceType, IndexType >;
+   constexpr bool is_const = std::is_const_v< typename VectorType::RealType >;
 
    vector
       // Comparison operators (Vector OP Vector)
       .def(
          "__eq__",
-         []( const VectorType& self, const VectorType& other )
+         []( const VectorType& self, const ConstViewType& other )
          {
+            pytnl::gil_release_for_size release( self.getSize() );
             return self == other;
          },
          nb::sig( "def __eq__(self, arg: object, /) -> bool" ),
          nb::is_operator() )
       .def(
          "__ne__",
-         []( const VectorType& self, const VectorType& other )
+         []( const VectorType& self, const ConstViewType& other )
          {
+            pytnl::gil_release_for_size release( self.getSize() );
             return self != other;
          },
          nb::sig( "def __ne__(self, arg: object, /) -> bool" ),
@@ -32,131 +62,174 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
       vector
          .def(
             "__lt__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return self < other;
             },
             nb::is_operator() )
          .def(
             "__le__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return self <= other;
             },
             nb::is_operator() )
          .def(
             "__gt__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return self > other;
             },
             nb::is_operator() )
          .def(
             "__ge__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
+               pytnl::gil_release_for_size release( self.getSize() );
                return self >= other;
             },
             nb::is_operator() );
    }
 
    if constexpr( TNL::IsScalarType< RealType >::value ) {
-      vector
-         // In-place arithmetic operators (Vector OP Vector)
-         .def(
-            "__iadd__",
-            []( VectorType& self, const VectorType& other ) -> VectorType&
-            {
-               self += other;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__isub__",
-            []( VectorType& self, const VectorType& other ) -> VectorType&
-            {
-               self -= other;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__imul__",
-            []( VectorType& self, const VectorType& other ) -> VectorType&
-            {
-               self *= other;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__idiv__",
-            []( VectorType& self, const VectorType& other ) -> VectorType&
-            {
-               self /= other;
-               return self;
-            },
-            nb::is_operator() )
+      if constexpr( ! is_const ) {
+         vector
+            // In-place arithmetic operators (Vector OP Vector)
+            .def(
+               "__iadd__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self += other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__isub__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self -= other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__imul__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self *= other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__itruediv__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self /= other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
 
-         // In-place arithmetic operators (Vector OP Scalar)
-         .def(
-            "__iadd__",
-            []( VectorType& self, RealType scalar ) -> VectorType&
-            {
-               self += scalar;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__isub__",
-            []( VectorType& self, RealType scalar ) -> VectorType&
-            {
-               self -= scalar;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__imul__",
-            []( VectorType& self, RealType scalar ) -> VectorType&
-            {
-               self *= scalar;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__idiv__",
-            []( VectorType& self, RealType scalar ) -> VectorType&
-            {
-               self /= scalar;
-               return self;
-            },
-            nb::is_operator() )
+            // In-place arithmetic operators (Vector OP Scalar)
+            .def(
+               "__iadd__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self += scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__isub__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self -= scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__imul__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self *= scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__itruediv__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self /= scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference );
+      }
 
+      vector
          // Binary arithmetic operators (Vector OP Vector)
          .def(
             "__add__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self + other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self + other );
             },
             nb::is_operator() )
          .def(
             "__sub__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self - other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self - other );
             },
             nb::is_operator() )
          .def(
             "__mul__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self * other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self * other );
             },
             nb::is_operator() )
          .def(
             "__truediv__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self / other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self / other );
             },
             nb::is_operator() )
 
@@ -165,28 +238,32 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
             "__add__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self + scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self + scalar );
             },
             nb::is_operator() )
          .def(
             "__sub__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self - scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self - scalar );
             },
             nb::is_operator() )
          .def(
             "__mul__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self * scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self * scalar );
             },
             nb::is_operator() )
          .def(
             "__truediv__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self / scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self / scalar );
             },
             nb::is_operator() )
 
@@ -195,28 +272,32 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
             "__radd__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar + self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar + self );
             },
             nb::is_operator() )
          .def(
             "__rsub__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar - self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar - self );
             },
             nb::is_operator() )
          .def(
             "__rmul__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar * self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar * self );
             },
             nb::is_operator() )
          .def(
             "__rtruediv__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar / self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar / self );
             },
             nb::is_operator() )
 
@@ -225,13 +306,15 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
             "__pos__",
             []( const VectorType& self )
             {
-               return VectorType( +self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( +self );
             } )
          .def(
             "__neg__",
             []( const VectorType& self )
             {
-               return VectorType( -self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( -self );
             } );
    }
 
@@ -241,113 +324,115 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
          // Modulo operators
          .def(
             "__mod__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self % other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self % other );
             },
             nb::is_operator() )
          .def(
             "__mod__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self % scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self % scalar );
             },
             nb::is_operator() )
          .def(
             "__rmod__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( other % self );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( other % self );
             },
             nb::is_operator() )
          .def(
             "__rmod__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar % self );
-            },
-            nb::is_operator() )
-         .def(
-            "__imod__",
-            []( VectorType& self, const VectorType& other ) -> VectorType&
-            {
-               self %= other;
-               return self;
-            },
-            nb::is_operator() )
-         .def(
-            "__imod__",
-            []( VectorType& self, RealType scalar ) -> VectorType&
-            {
-               self %= scalar;
-               return self;
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar % self );
             },
             nb::is_operator() )
 
          // Bitwise operators
          .def(
             "__and__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self & other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self & other );
             },
             nb::is_operator() )
          .def(
             "__and__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self & scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self & scalar );
             },
             nb::is_operator() )
          .def(
             "__rand__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar & self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar & self );
             },
             nb::is_operator() )
 
          .def(
             "__or__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self | other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self | other );
             },
             nb::is_operator() )
          .def(
             "__or__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self | scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self | scalar );
             },
             nb::is_operator() )
          .def(
             "__ror__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar | self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar | self );
             },
             nb::is_operator() )
 
          .def(
             "__xor__",
-            []( const VectorType& self, const VectorType& other )
+            []( const VectorType& self, const ConstViewType& other )
             {
-               return VectorType( self ^ other );
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self ^ other );
             },
             nb::is_operator() )
          .def(
             "__xor__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( self ^ scalar );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( self ^ scalar );
             },
             nb::is_operator() )
          .def(
             "__rxor__",
             []( const VectorType& self, RealType scalar )
             {
-               return VectorType( scalar ^ self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( scalar ^ self );
             },
             nb::is_operator() )
 
@@ -356,8 +441,124 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
             "__invert__",
             []( const VectorType& self )
             {
-               return VectorType( ~self );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( ~self );
             } );
+
+      if constexpr( ! is_const ) {
+         vector
+            // In-place modulo operators
+            .def(
+               "__imod__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self %= other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__imod__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self %= scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+
+            // In-place bitwise operators
+            .def(
+               "__iand__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self & other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__iand__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self & scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__ior__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self | other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__ior__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self | scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__ixor__",
+               []( VectorType& self, const ConstViewType& other ) -> VectorType&
+               {
+                  check_vector_sizes( self.getSize(), other.getSize(), "other" );
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self ^ other;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference )
+            .def(
+               "__ixor__",
+               []( VectorType& self, RealType scalar ) -> VectorType&
+               {
+                  pytnl::containers::detach( self );
+                  pytnl::gil_release_for_size release( self.getSize() );
+                  self = self ^ scalar;
+                  return self;
+               },
+               nb::is_operator(),
+               nb::rv_policy::reference );
+      }
+   }
+
+   // In-place operators cannot modify const views. Without defining them,
+   // Python would silently fall back to the out-of-place operators.
+   if constexpr( is_const ) {
+      std::vector< const char* > names = { "__iadd__", "__isub__", "__imul__", "__itruediv__" };
+      if constexpr( std::is_integral_v< RealType > )
+         names.insert( names.end(), { "__imod__", "__iand__", "__ior__", "__ixor__" } );
+      for( const char* name : names )
+         vector.def(
+            name,
+            []( const VectorType&, nb::handle ) -> nb::object
+            {
+               throw nb::type_error( "in-place operations are not supported for constant views" );
+            },
+            nb::is_operator() );
    }
 
    // While not operators, these functions are defined as expression templates
@@ -366,7 +567,8 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
       "__abs__",
       []( const VectorType& self )
       {
-         return VectorType( TNL::abs( self ) );
+         pytnl::gil_release_for_size release( self.getSize() );
+         return ResultType( TNL::abs( self ) );
       } );
    if constexpr( TNL::IsScalarType< RealType >::value && ! TNL::is_complex_v< RealType > ) {
       vector  //
@@ -374,13 +576,15 @@ def_vector_operators( nb::class_< VectorType, Args... >& vector )
             "__floor__",
             []( const VectorType& self )
             {
-               return VectorType( TNL::floor( self ) );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::floor( self ) );
             } )
          .def(
             "__ceil__",
             []( const VectorType& self )
             {
-               return VectorType( TNL::ceil( self ) );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::ceil( self ) );
             } );
    }
 }
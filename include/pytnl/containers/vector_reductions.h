@@ -0,0 +1,272 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <string>
+
+#include <TNL/Algorithms/reduce.h>
+#include <TNL/Functional.h>
+#include <TNL/Math.h>
+#include <TNL/TypeTraits.h>
+#include <pytnl/gil.h>
+#include <pytnl/pytnl.h>
+
+#include "vector_operators.h"
+
+template< typename Index >
+void
+check_nonempty_reduction( Index size, const char* name )
+{
+   if( size == 0 )
+      throw nb::value_error( ( std::string( name ) + " of an empty vector is not defined" ).c_str() );
+}
+
+inline void
+check_lp_norm_order( double p )
+{
+   if( ! ( p >= 1 ) )
+      throw nb::value_error( "the lp-norm is defined only for p >= 1" );
+}
+
+//! \brief Computes `sum(abs(v)**p)` of a real vector in double precision.
+template< typename VectorType >
+double
+sum_of_abs_powers( const VectorType& v, double p )
+{
+   using IndexType = typename VectorType::IndexType;
+   const auto* data = v.getData();
+   auto fetch = [ = ] __cuda_callable__( IndexType i ) -> double
+   {
+      const double x = TNL::abs( double( data[ i ] ) );
+      return p == 2 ? x * x : TNL::pow( x, p );
+   };
+   return TNL::Algorithms::reduce< typename VectorType::DeviceType >( IndexType{ 0 }, v.getSize(), fetch, TNL::Plus{} );
+}
+
+/* Reductions over all elements of a vector (or a vector view), evaluated with
+ * the parallel reductions of TNL without any temporary vectors.
+ *
+ * The l2 and lp norms are accumulated in double precision, so they do not
+ * overflow for integer vectors. Complex vectors do not have an ordering, so
+ * they do not get min/max/argMin/argMax, and their norms are computed from
+ * std::abs on the host (the TNL norms assume real values, e.g. l2Norm is
+ * sqrt(dot(v, v))).
+ */
+template< typename VectorType, typename... Args >
+void
+def_vector_reductions( nb::class_< VectorType, Args... >& vector )
+{
+   using RealType = std::remove_const_t< typename VectorType::RealType >;
+   using DeviceType = typename VectorType::DeviceType;
+   using IndexType = typename VectorType::IndexType;
+   using ConstViewType = typename VectorType::ConstViewType;
+   // 16-bit values are accumulated and returned in single precision
+   using ResultType = pytnl::compute_type_t< RealType >;
+
+   if constexpr( TNL::IsScalarType< RealType >::value ) {
+      vector
+         .def(
+            "sum",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::sum( self ) );
+            },
+            "Returns the sum of all elements." )
+         .def(
+            "product",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::product( self ) );
+            },
+            "Returns the product of all elements." )
+         .def(
+            "dot",
+            []( const VectorType& self, const ConstViewType& other )
+            {
+               check_vector_sizes( self.getSize(), other.getSize(), "other" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::dot( self, other ) );
+            },
+            nb::arg( "other" ),
+            "Returns the dot product `sum(self * other)` (complex values are not conjugated)." );
+   }
+
+   if constexpr( TNL::IsScalarType< RealType >::value && ! TNL::is_complex_v< RealType > ) {
+      vector
+         .def(
+            "min",
+            []( const VectorType& self )
+            {
+               check_nonempty_reduction( self.getSize(), "minimum" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::min( self ) );
+            },
+            "Returns the minimum of all elements." )
+         .def(
+            "max",
+            []( const VectorType& self )
+            {
+               check_nonempty_reduction( self.getSize(), "maximum" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::max( self ) );
+            },
+            "Returns the maximum of all elements." )
+         .def(
+            "argMin",
+            []( const VectorType& self )
+            {
+               check_nonempty_reduction( self.getSize(), "minimum" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return TNL::argMin( self );
+            },
+            "Returns a tuple `(value, index)` of the minimum and the index of its first occurrence." )
+         .def(
+            "argMax",
+            []( const VectorType& self )
+            {
+               check_nonempty_reduction( self.getSize(), "maximum" );
+               pytnl::gil_release_for_size release( self.getSize() );
+               return TNL::argMax( self );
+            },
+            "Returns a tuple `(value, index)` of the maximum and the index of its first occurrence." )
+         .def(
+            "l1Norm",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::l1Norm( self ) );
+            },
+            "Returns the sum of absolute values of all elements." )
+         .def(
+            "l2Norm",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return std::sqrt( sum_of_abs_powers( self, 2.0 ) );
+            },
+            "Returns the Euclidean norm." )
+         .def(
+            "maxNorm",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return ResultType( TNL::maxNorm( self ) );
+            },
+            "Returns the maximum of absolute values of all elements." )
+         .def(
+            "lpNorm",
+            []( const VectorType& self, double p )
+            {
+               check_lp_norm_order( p );
+               pytnl::gil_release_for_size release( self.getSize() );
+               // the limit for p -> inf is the max-norm, the formula would give 1
+               if( std::isinf( p ) )
+                  return double( TNL::maxNorm( self ) );
+               return std::pow( sum_of_abs_powers( self, p ), 1.0 / p );
+            },
+            nb::arg( "p" ),
+            "Returns the lp-norm `sum(abs(self)**p)**(1/p)` for `p >= 1`, or the max-norm for `p = inf`." )
+         .def(
+            "any",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return bool( TNL::logicalOr( self ) );
+            },
+            "Returns `True` if any element is non-zero." )
+         .def(
+            "all",
+            []( const VectorType& self )
+            {
+               pytnl::gil_release_for_size release( self.getSize() );
+               return bool( TNL::logicalAnd( self ) );
+            },
+            "Returns `True` if all elements are non-zero." );
+   }
+   else if constexpr( TNL::is_complex_v< RealType > && std::is_same_v< DeviceType, TNL::Devices::Host > ) {
+      using NormType = decltype( std::abs( RealType{} ) );
+
+      // reduces the results of `fetch( element )` over all elements
+      auto reduce = []( const VectorType& self, auto fetch, auto reduction, NormType identity )
+      {
+         pytnl::gil_release_for_size release( self.getSize() );
+         const RealType* data = self.getData();
+         return TNL::Algorithms::reduce< DeviceType >(
+            IndexType{ 0 },
+            self.getSize(),
+            [ = ]( IndexType i )
+            {
+               return fetch( data[ i ] );
+            },
+            reduction,
+            identity );
+      };
+      auto absolute = []( const RealType& x )
+      {
+         return std::abs( x );
+      };
+      auto nonzero = []( const RealType& x )
+      {
+         return NormType( x != RealType{ 0 } );
+      };
+
+      vector
+         .def(
+            "l1Norm",
+            [ = ]( const VectorType& self )
+            {
+               return reduce( self, absolute, TNL::Plus{}, 0 );
+            },
+            "Returns the sum of absolute values of all elements." )
+         .def(
+            "l2Norm",
+            [ = ]( const VectorType& self )
+            {
+               auto norm = []( const RealType& x )
+               {
+                  return std::norm( x );
+               };
+               return std::sqrt( reduce( self, norm, TNL::Plus{}, 0 ) );
+            },
+            "Returns the Euclidean norm." )
+         .def(
+            "maxNorm",
+            [ = ]( const VectorType& self )
+            {
+               return reduce( self, absolute, TNL::Max{}, 0 );
+            },
+            "Returns the maximum of absolute values of all elements." )
+         .def(
+            "lpNorm",
+            [ = ]( const VectorType& self, double p )
+            {
+               check_lp_norm_order( p );
+               // the limit for p -> inf is the max-norm, the formula would give 1
+               if( std::isinf( p ) )
+                  return double( reduce( self, absolute, TNL::Max{}, 0 ) );
+               auto power = [ p ]( const RealType& x )
+               {
+                  return std::pow( std::abs( x ), p );
+               };
+               return double( std::pow( reduce( self, power, TNL::Plus{}, 0 ), 1.0 / p ) );
+            },
+            nb::arg( "p" ),
+            "Returns the lp-norm `sum(abs(self)**p)**(1/p)` for `p >= 1`, or the max-norm for `p = inf`." )
+         .def(
+            "any",
+            [ = ]( const VectorType& self )
+            {
+               return reduce( self, nonzero, TNL::Max{}, 0 ) > 0;
+            },
+            "Returns `True` if any element is non-zero." )
+         .def(
+            "all",
+            [ = ]( const VectorType& self )
+            {
+               return reduce( self, nonzero, TNL::Min{}, 1 ) > 0;
+            },
+            "Returns `True` if all elements are non-zero." );
+   }
+}
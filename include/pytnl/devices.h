@@ -0,0 +1,28 @@
+#pragma once
+
+#include <nanobind/nanobind.h>
+
+#include <TNL/Devices/Host.h>
+
+/* Each PyTNL extension module has its own copy of the global TNL settings for
+ * the Host device (e.g. the maximal number of OpenMP threads), because the
+ * modules are built with hidden symbol visibility. Hence each module exports
+ * the functions below, which are used by `pytnl.devices.Host` to keep the
+ * settings of all loaded modules in sync.
+ */
+inline void
+register_host_device( nanobind::module_& m )
+{
+   m.def( "_Host_setMaxThreadsCount", &TNL::Devices::Host::setMaxThreadsCount, nanobind::arg( "count" ) );
+   m.def( "_Host_getMaxThreadsCount", &TNL::Devices::Host::getMaxThreadsCount );
+   m.def( "_Host_isOMPEnabled", &TNL::Devices::Host::isOMPEnabled );
+
+   // Apply the settings made before this module was loaded. The pytnl.devices
+   // module is not imported here, if it was not loaded yet, no settings were made.
+   nanobind::object devices = nanobind::module_::import_( "sys" ).attr( "modules" ).attr( "get" )( "pytnl.devices" );
+   if( ! devices.is_none() ) {
+      nanobind::object count = devices.attr( "Host" ).attr( "_max_threads_count" );
+      if( ! count.is_none() )
+         TNL::Devices::Host::setMaxThreadsCount( nanobind::cast< int >( count ) );
+   }
+}
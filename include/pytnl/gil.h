@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <nanobind/nanobind.h>
+
+namespace pytnl {
+
+/**
+ * Minimal number of elements for which bindings of bulk operations release
+ * the GIL. Releasing and re-acquiring the GIL costs about as much as a few
+ * thousand element operations, so calls on small arrays keep holding it.
+ */
+constexpr std::size_t gil_release_threshold = 1 << 15;
+
+/**
+ * RAII guard releasing the GIL for the rest of the enclosing scope if the
+ * operation processes at least `gil_release_threshold` elements.
+ *
+ * The guard must be created only after all arguments have been converted from
+ * Python objects and no Python API may be used while it is alive. Errors are
+ * reported by throwing C++ exceptions, which re-acquire the GIL when the guard
+ * is destroyed during stack unwinding.
+ */
+class gil_release_for_size
+{
+public:
+   template< typename Index >
+   explicit gil_release_for_size( Index size )
+   {
+      if( size > 0 && static_cast< std::size_t >( size ) >= gil_release_threshold )
+         release.emplace();
+   }
+
+private:
+   std::optional< nanobind::gil_scoped_release > release;
+};
+
+}  // namespace pytnl
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include <TNL/TypeTraits.h>
+
+namespace pytnl {
+
+namespace detail {
+
+inline std::uint32_t
+float_bits( float value )
+{
+   std::uint32_t bits;
+   std::memcpy( &bits, &value, sizeof( bits ) );
+   return bits;
+}
+
+inline float
+bits_float( std::uint32_t bits )
+{
+   float value;
+   std::memcpy( &value, &bits, sizeof( value ) );
+   return value;
+}
+
+/**
+ * \brief Converts a double to float with rounding to odd: inexact results are
+ * truncated and their last bit is set.
+ *
+ * The 16-bit formats have at least 2 bits less than float, so rounding the
+ * result to nearest again gives the correctly rounded value of the double
+ * (Boldo and Melquiond, "When double rounding is odd"). Rounding to nearest
+ * twice would not, e.g. for values just above a tie of the 16-bit format.
+ */
+inline float
+double_to_float_round_odd( double value )
+{
+   const float rounded = static_cast< float >( value );
+   if( std::isinf( rounded ) || std::isnan( rounded ) || static_cast< double >( rounded ) == value )
+      return rounded;
+   float truncated = rounded;
+   if( std::fabs( static_cast< double >( rounded ) ) > std::fabs( value ) )
+      truncated = std::nextafter( rounded, 0.0f );
+   return bits_float( float_bits( truncated ) | 1u );
+}
+
+//! \brief Converts a float to the IEEE 754 binary16 format (rounding to nearest, ties to even).
+inline std::uint16_t
+float_to_binary16( float value )
+{
+   std::uint32_t x = float_bits( value );
+   const std::uint32_t sign = ( x >> 16 ) & 0x8000u;
+   x &= 0x7fffffffu;
+
+   // infinity or NaN (NaNs stay quiet)
+   if( x >= 0x7f800000u )
+      return sign | 0x7c00u | ( x > 0x7f800000u ? 0x0200u | ( ( x >> 13 ) & 0x3ffu ) : 0u );
+   // values rounding to 65520 and above overflow
+   if( x >= 0x477ff000u )
+      return sign | 0x7c00u;
+   // subnormal results (|value| < 2^-14)
+   if( x < 0x38800000u ) {
+      // values up to 2^-25 (inclusive, tie to even) round to zero
+      if( x <= 0x33000000u )
+         return sign;
+      const std::uint32_t shift = 126 - ( x >> 23 );
+      const std::uint32_t mantissa = ( x & 0x7fffffu ) | 0x800000u;
+      std::uint32_t result = mantissa >> shift;
+      const std::uint32_t rest = mantissa & ( ( 1u << shift ) - 1 );
+      const std::uint32_t halfway = 1u << ( shift - 1 );
+      if( rest > halfway || ( rest == halfway && ( result & 1u ) ) )
+         result++;
+      return sign | result;
+   }
+   // normal results: rebias the exponent and round the mantissa (a carry correctly increments the exponent)
+   std::uint32_t result = ( x - 0x38000000u ) >> 13;
+   const std::uint32_t rest = x & 0x1fffu;
+   if( rest > 0x1000u || ( rest == 0x1000u && ( result & 1u ) ) )
+      result++;
+   return sign | result;
+}
+
+//! \brief Converts a value in the IEEE 754 binary16 format to float (exactly).
+inline float
+binary16_to_float( std::uint16_t bits )
+{
+   const std::uint32_t sign = std::uint32_t( bits & 0x8000u ) << 16;
+   const std::uint32_t exponent = ( bits >> 10 ) & 0x1fu;
+   const std::uint32_t mantissa = bits & 0x3ffu;
+   if( exponent == 0x1f )
+      return bits_float( sign | 0x7f800000u | ( mantissa << 13 ) );
+   if( exponent != 0 )
+      return bits_float( sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 ) );
+   // zero or subnormal: mantissa * 2^-24
+   const float value = float( mantissa ) * 5.9604644775390625e-8f;
+   return sign ? -value : value;
+}
+
+//! \brief Converts a float to bfloat16 (the upper half of the float, rounding to nearest, ties to even).
+inline std::uint16_t
+float_to_bfloat16( float value )
+{
+   const std::uint32_t x = float_bits( value );
+   // keep NaNs quiet (rounding could turn them into infinities)
+   if( ( x & 0x7fffffffu ) > 0x7f800000u )
+      return std::uint16_t( ( x >> 16 ) | 0x0040u );
+   return std::uint16_t( ( x + 0x7fffu + ( ( x >> 16 ) & 1u ) ) >> 16 );
+}
+
+inline float
+bfloat16_to_float( std::uint16_t bits )
+{
+   return bits_float( std::uint32_t( bits ) << 16 );
+}
+
+}  // namespace detail
+
+/* 16-bit floating-point storage types. The values are converted to float
+ * whenever they are read, so all arithmetic (including the vector expressions
+ * and reductions of TNL) is computed in single precision and the results are
+ * rounded only when they are stored. This halves the memory traffic of
+ * bandwidth-bound operations compared to float and quarters it compared to
+ * double.
+ */
+template< typename Format >
+class basic_half
+{
+public:
+   basic_half() = default;
+
+   basic_half( float value )
+   : bits( Format::encode( value ) )
+   {}
+
+   //! \brief Conversion from double, rounded to nearest only once.
+   basic_half( double value )
+   : basic_half( detail::double_to_float_round_odd( value ) )
+   {}
+
+   // integers would be ambiguous between float and double
+   template< typename Integer, std::enable_if_t< std::is_integral_v< Integer >, int > = 0 >
+   basic_half( Integer value )
+   : basic_half( static_cast< double >( value ) )
+   {}
+
+   operator float() const
+   {
+      return Format::decode( bits );
+   }
+
+   [[nodiscard]] static basic_half
+   fromBits( std::uint16_t bits )
+   {
+      basic_half result;
+      result.bits = bits;
+      return result;
+   }
+
+   [[nodiscard]] std::uint16_t
+   getBits() const
+   {
+      return bits;
+   }
+
+   // compound assignment is not provided by the implicit conversions
+   basic_half&
+   operator+=( float value )
+   {
+      return *this = float( *this ) + value;
+   }
+
+   basic_half&
+   operator-=( float value )
+   {
+      return *this = float( *this ) - value;
+   }
+
+   basic_half&
+   operator*=( float value )
+   {
+      return *this = float( *this ) * value;
+   }
+
+   basic_half&
+   operator/=( float value )
+   {
+      return *this = float( *this ) / value;
+   }
+
+private:
+   std::uint16_t bits;
+};
+
+struct binary16_format
+{
+   static std::uint16_t
+   encode( float value )
+   {
+      return detail::float_to_binary16( value );
+   }
+
+   static float
+   decode( std::uint16_t bits )
+   {
+      return detail::binary16_to_float( bits );
+   }
+};
+
+struct bfloat16_format
+{
+   static std::uint16_t
+   encode( float value )
+   {
+      return detail::float_to_bfloat16( value );
+   }
+
+   static float
+   decode( std::uint16_t bits )
+   {
+      return detail::bfloat16_to_float( bits );
+   }
+};
+
+//! \brief IEEE 754 half precision (5 exponent bits, 10 mantissa bits), `numpy.float16`.
+using float16 = basic_half< binary16_format >;
+
+//! \brief Brain floating point (8 exponent bits, 7 mantissa bits), the range of float with less precision.
+using bfloat16 = basic_half< bfloat16_format >;
+
+template< typename T >
+struct is_half : std::false_type
+{};
+
+template< typename Format >
+struct is_half< basic_half< Format > > : std::true_type
+{};
+
+template< typename T >
+constexpr bool is_half_v = is_half< std::remove_cv_t< T > >::value;
+
+//! \brief Type used for the accumulation of reductions over elements of type `T`.
+template< typename T >
+using compute_type_t = std::conditional_t< is_half_v< T >, float, T >;
+
+template< typename Format >
+std::ostream&
+operator<<( std::ostream& str, const basic_half< Format >& value )
+{
+   return str << float( value );
+}
+
+}  // namespace pytnl
+
+namespace TNL {
+
+// the 16-bit types are scalars for the expression templates and reductions of TNL
+template< typename Format >
+struct IsScalarType< pytnl::basic_half< Format > > : public std::true_type
+{};
+
+}  // namespace TNL
+
+namespace std {
+
+template<>
+class numeric_limits< pytnl::float16 >
+{
+   using T = pytnl::float16;
+
+public:
+   static constexpr bool is_specialized = true;
+   static constexpr bool is_signed = true;
+   static constexpr bool is_integer = false;
+   static constexpr bool is_exact = false;
+   static constexpr bool has_infinity = true;
+   static constexpr bool has_quiet_NaN = true;
+   static constexpr int digits = 11;
+   static constexpr int max_exponent = 16;
+   static constexpr int min_exponent = -13;
+
+   // clang-format off
+   static T min() { return T::fromBits( 0x0400 ); }
+   static T max() { return T::fromBits( 0x7bff ); }
+   static T lowest() { return T::fromBits( 0xfbff ); }
+   static T epsilon() { return T::fromBits( 0x1400 ); }
+   static T infinity() { return T::fromBits( 0x7c00 ); }
+   static T quiet_NaN() { return T::fromBits( 0x7e00 ); }
+   // clang-format on
+};
+
+template<>
+class numeric_limits< pytnl::bfloat16 >
+{
+   using T = pytnl::bfloat16;
+
+public:
+   static constexpr bool is_specialized = true;
+   static constexpr bool is_signed = true;
+   static constexpr bool is_integer = false;
+   static constexpr bool is_exact = false;
+   static constexpr bool has_infinity = true;
+   static constexpr bool has_quiet_NaN = true;
+   static constexpr int digits = 8;
+   static constexpr int max_exponent = 128;
+   static constexpr int min_exponent = -125;
+
+   // clang-format off
+   static T min() { return T::fromBits( 0x0080 ); }
+   static T max() { return T::fromBits( 0x7f7f ); }
+   static T lowest() { return T::fromBits( 0xff7f ); }
+   static T epsilon() { return T::fromBits( 0x3c00 ); }
+   static T infinity() { return T::fromBits( 0x7f80 ); }
+   static T quiet_NaN() { return T::fromBits( 0x7fc0 ); }
+   // clang-format on
+};
+
+}  // namespace std
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+
+#include <pytnl/half.h>
+
+namespace nanobind {
+namespace detail {
+
+template< typename Format >
+class type_caster< pytnl::basic_half< Format > >
+{
+   using HalfType = pytnl::basic_half< Format >;
+
+public:
+   NB_TYPE_CASTER( HalfType, const_name( "float" ) );
+
+   /**
+    * Conversion from Python to C++: convert a Python float (or any object
+    * convertible to float, e.g. `numpy.float16`) and round it to 16 bits
+    * (directly from double, without the intermediate rounding to float).
+    */
+   bool
+   from_python( handle src, std::uint8_t flags, cleanup_list* ) noexcept
+   {
+      double result;
+      if( ! load_f64( src.ptr(), flags, &result ) )
+         return false;
+      value = HalfType( result );
+      return true;
+   }
+
+   /**
+    * Conversion from C++ to Python: the value is widened to a Python float.
+    */
+   static handle
+   from_cpp( const HalfType& src, rv_policy, cleanup_list* ) noexcept
+   {
+      return PyFloat_FromDouble( static_cast< float >( src ) );
+   }
+};
+
+template<>
+struct dtype_traits< pytnl::float16 >
+{
+   static constexpr dlpack::dtype value{ static_cast< std::uint8_t >( dlpack::dtype_code::Float ), 16, 1 };
+   static constexpr auto name = const_name( "float16" );
+};
+
+template<>
+struct dtype_traits< pytnl::bfloat16 >
+{
+   static constexpr dlpack::dtype value{ static_cast< std::uint8_t >( dlpack::dtype_code::Bfloat ), 16, 1 };
+   static constexpr auto name = const_name( "bfloat16" );
+};
+
+}  // namespace detail
+}  // namespace nanobind
@@ -26,6 +26,7 @@
 #include <pytnl/iostream_caster.h>
 #include <pytnl/string_caster.h>
 #include <pytnl/SizesHolder_caster.h>
+#include <pytnl/half_caster.h>
 
 // Common namespace alias
 namespace nb = nanobind;
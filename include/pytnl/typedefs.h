@@ -1,5 +1,10 @@
 #pragma once
 
+#include <type_traits>
+
+#include <TNL/Allocators/Default.h>
+#include <TNL/Containers/Array.h>
+#include <TNL/Containers/Vector.h>
 #include <TNL/Meshes/DefaultConfig.h>
 #include <TNL/Meshes/DistributedMeshes/DistributedMesh.h>
 #include <TNL/Meshes/Grid.h>
@@ -13,9 +18,39 @@
 #include <TNL/Meshes/Topologies/Triangle.h>
 #include <TNL/Meshes/TypeResolver/BuildConfigTags.h>
 
+#include <pytnl/CachingAllocator.h>
+#include <pytnl/half.h>
+
 using RealType = double;
 using IndexType = std::int64_t;
 using ComplexType = std::complex< RealType >;
+// single precision for bandwidth-bound workloads (classes with the "_float32" suffix)
+using Float32Type = float;
+// 32-bit column indices of sparse matrices (classes with the "_index32" suffix)
+using Index32Type = std::int32_t;
+// 16-bit storage with float compute (classes with the "_float16" and "_bfloat16" suffixes)
+using Float16Type = pytnl::float16;
+using BFloat16Type = pytnl::bfloat16;
+
+namespace pytnl {
+
+/* Allocator of the arrays exposed to Python. Host memory comes from the
+ * caching pool (which is disabled by default, see CachingAllocator.h), other
+ * devices use the TNL default allocators. All containers passed between the
+ * Python modules must use these aliases, otherwise the types do not match.
+ */
+template< typename Value, typename Device >
+using Allocator = std::conditional_t< std::is_same_v< Device, TNL::Devices::Host >,
+                                      allocators::CachingHost< Value >,
+                                      typename TNL::Allocators::Default< Device >::template Allocator< Value > >;
+
+template< typename Value, typename Device, typename Index = ::IndexType >
+using Array = TNL::Containers::Array< Value, Device, Index, Allocator< Value, Device > >;
+
+template< typename Value, typename Device, typename Index = ::IndexType >
+using Vector = TNL::Containers::Vector< Value, Device, Index, Allocator< Value, Device > >;
+
+}  // namespace pytnl
 
 using Grid_1_host = TNL::Meshes::Grid< 1, RealType, TNL::Devices::Host, IndexType >;
 using Grid_2_host = TNL::Meshes::Grid< 2, RealType, TNL::Devices::Host, IndexType >;
@@ -4,10 +4,23 @@ import importlib
 from types import ModuleType
 from typing import Any, Literal, TypeGuard, cast, get_args
 
+import numpy as np
+
 import pytnl.devices
 
-# value types
-type VT = int | float | complex
+
+class bfloat16:
+    """
+    Marker type selecting the bfloat16 containers, e.g. `Vector[bfloat16]`.
+
+    NumPy does not have a bfloat16 dtype, so the elements are exchanged as
+    Python floats and exported via DLPack with the bfloat16 type code.
+    """
+
+
+# value types (`np.float32` selects the single-precision classes, `np.int32`
+# the 32-bit integer arrays, `np.float16` and `bfloat16` the 16-bit storage)
+type VT = int | float | complex | np.float32 | np.int32 | np.float16 | bfloat16
 
 # device types
 type DT = pytnl.devices.Host | pytnl.devices.Cuda
@@ -2,14 +2,16 @@
 
 #include <pytnl/containers/Array.h>
 #include <pytnl/containers/Vector.h>
+#include <pytnl/containers/vector_functions.h>
 
 using namespace TNL::Containers;
 
+// host arrays use the caching allocator (see CachingAllocator.h)
 template< typename T >
-using _array = Array< T, TNL::Devices::Host, IndexType >;
+using _array = pytnl::Array< T, TNL::Devices::Host, IndexType >;
 
 template< typename T >
-using _vector = Vector< T, TNL::Devices::Host, IndexType >;
+using _vector = pytnl::Vector< T, TNL::Devices::Host, IndexType >;
 
 template< typename T >
 using _array_view = ArrayView< T, TNL::Devices::Host, IndexType >;
@@ -17,9 +19,183 @@ using _array_view = ArrayView< T, TNL::Devices::Host, IndexType >;
 template< typename T >
 using _vector_view = VectorView< T, TNL::Devices::Host, IndexType >;
 
+static void
+export_CachingAllocator( nb::module_& m )
+{
+   using Pool = pytnl::allocators::CachingPool;
+   using HugePages = pytnl::allocators::HugePages;
+   using NumaPolicy = pytnl::allocators::NumaPolicy;
+
+   nb::enum_< HugePages >( m, "HugePages", "Huge page policies for large host allocations." )
+      .value( "NONE", HugePages::None )
+      .value( "TRANSPARENT", HugePages::Transparent )
+      .value( "EXPLICIT", HugePages::Explicit );
+
+   nb::enum_< NumaPolicy >( m, "NumaPolicy", "NUMA placement policies for large host allocations." )
+      .value( "DEFAULT", NumaPolicy::Default )
+      .value( "FIRST_TOUCH", NumaPolicy::FirstTouch )
+      .value( "INTERLEAVE", NumaPolicy::Interleave )
+      .value( "BIND", NumaPolicy::Bind );
+
+   nb::class_< Pool >( m,
+                       "CachingAllocator",
+                       "Allocator of all host arrays, vectors and NDArrays with an opt-in cache of freed blocks.\n\n"
+                       "When enabled, memory of destroyed arrays is kept in per-size-class free lists and reused "
+                       "by subsequent allocations of the same size class (e.g. results of vector operators in a "
+                       "time loop), which avoids malloc/free calls and page faults of fresh memory. Large "
+                       "blocks can be backed by huge pages, see `setHugePages`." )
+      .def_static( "isEnabled",
+                   []()
+                   {
+                      return Pool::getInstance().isEnabled();
+                   } )
+      .def_static(
+         "setEnabled",
+         []( bool enabled )
+         {
+            Pool::getInstance().setEnabled( enabled );
+         },
+         nb::arg( "enabled" ),
+         "Enables or disables caching. Disabling releases all cached blocks." )
+      .def_static( "getMaxCachedBytes",
+                   []()
+                   {
+                      return Pool::getInstance().getMaxCachedBytes();
+                   } )
+      .def_static(
+         "setMaxCachedBytes",
+         []( std::size_t bytes )
+         {
+            Pool::getInstance().setMaxCachedBytes( bytes );
+         },
+         nb::arg( "bytes" ),
+         "Sets the limit of the total size of cached blocks (1 GiB by default)." )
+      .def_static(
+         "setHugePages",
+         []( HugePages policy, std::size_t threshold )
+         {
+            Pool::getInstance().setHugePages( policy, threshold );
+         },
+         nb::arg( "policy" ),
+         nb::arg( "threshold" ) = Pool::largeBlockSize,
+         "Sets the huge page policy for new allocations of at least `threshold` bytes.\n\n"
+         "Allocations of at least 2 MiB are always mapped with the huge page alignment. TRANSPARENT "
+         "advises the kernel to back them with transparent huge pages (MADV_HUGEPAGE), EXPLICIT "
+         "takes them from the reserved hugetlbfs pool (MAP_HUGETLB) and falls back to TRANSPARENT "
+         "when it is exhausted. The policy does not affect blocks that are already allocated or cached." )
+      .def_static( "getHugePages",
+                   []()
+                   {
+                      return Pool::getInstance().getHugePages();
+                   } )
+      .def_static( "getHugePageThreshold",
+                   []()
+                   {
+                      return Pool::getInstance().getHugePageThreshold();
+                   } )
+      .def_static(
+         "setNumaPolicy",
+         []( NumaPolicy policy, int node )
+         {
+            if( node < 0 || node >= 64 )
+               throw nb::value_error( ( "invalid NUMA node " + std::to_string( node ) ).c_str() );
+            Pool::getInstance().setNumaPolicy( policy, node );
+         },
+         nb::arg( "policy" ),
+         nb::arg( "node" ) = 0,
+         "Sets the NUMA placement of the pages of new allocations of at least 2 MiB.\n\n"
+         "DEFAULT leaves the placement to the first thread touching each page. FIRST_TOUCH touches "
+         "the pages right after the allocation using the same static OpenMP partition as the parallel "
+         "kernels, so arrays filled from the main thread (e.g. from Python sequences) are still "
+         "distributed across the sockets like the threads that later process them. INTERLEAVE spreads "
+         "the pages round-robin over all nodes, BIND allocates them only on `node` (the allocation "
+         "fails when the node runs out of memory). The policy does not affect blocks that are already "
+         "allocated or cached." )
+      .def_static( "getNumaPolicy",
+                   []()
+                   {
+                      return Pool::getInstance().getNumaPolicy();
+                   } )
+      .def_static( "getNumaNode",
+                   []()
+                   {
+                      return Pool::getInstance().getNumaNode();
+                   } )
+      .def_static(
+         "trim",
+         []()
+         {
+            nb::gil_scoped_release release;
+            Pool::getInstance().trim();
+         },
+         "Releases all cached blocks to the system." )
+      .def_static(
+         "getStatistics",
+         []()
+         {
+            const Pool::Statistics stats = Pool::getInstance().getStatistics();
+            nb::typed< nb::dict, nb::str, int > result;
+            result[ "hits" ] = stats.hits;
+            result[ "misses" ] = stats.misses;
+            result[ "releases" ] = stats.releases;
+            result[ "cachedBlocks" ] = stats.cachedBlocks;
+            result[ "cachedBytes" ] = stats.cachedBytes;
+            result[ "sharedBlocks" ] = stats.sharedBlocks;
+            return result;
+         },
+         "Returns the numbers of allocations served from the cache (hits) and from the system (misses), "
+         "the number of freed blocks which were not cached (releases), the current size of the cache and "
+         "the number of blocks shared by copy-on-write copies." )
+      .def_static(
+         "resetStatistics",
+         []()
+         {
+            Pool::getInstance().resetStatistics();
+         },
+         "Resets the hits, misses and releases counters." );
+}
+
+void
+export_copy_on_write( nb::module_& m )
+{
+   using Pool = pytnl::allocators::CachingPool;
+
+   m.def(
+      "setCopyOnWrite",
+      []( bool enabled )
+      {
+         Pool::getInstance().setCopyOnWrite( enabled );
+      },
+      nb::arg( "enabled" ),
+      "Enables or disables copy-on-write copies (disabled by default).\n\n"
+      "When enabled, `copy.copy` of a host array, vector or NDArray returns an object sharing the data "
+      "with the original. The data is copied (in one bulk copy) only when one of them is modified for "
+      "the first time, e.g. by `setElement`, `__setitem__`, `setValue` or an in-place operator.\n\n"
+      "Writable views, slices and exports (`getView`, NumPy arrays, DLPack or the buffer protocol) write "
+      "into the data directly. Creating them detaches the array from its copies, and `copy.copy` of an "
+      "array whose data may have such views or exports (created at any time since the data was "
+      "allocated) returns a deep copy, so that the copy is never modified through them. `copy.deepcopy` "
+      "always copies the data." );
+   m.def(
+      "isCopyOnWrite",
+      []()
+      {
+         return Pool::getInstance().isCopyOnWrite();
+      },
+      "Returns `True` if copy-on-write copies are enabled." );
+}
+
 void
 export_ArrayVector( nb::module_& m )
 {
+   export_CachingAllocator( m );
+   export_copy_on_write( m );
+
+   // must be registered before the array methods using it as a default argument
+   export_scan_operation( m );
+
+   export_BitArray( m, "BitArray" );
+
    export_Array< _array< bool > >( m, "Array_bool" );
    export_Array< _array< IndexType > >( m, "Array_int" );
    export_Array< _array< RealType > >( m, "Array_float" );
@@ -27,6 +203,14 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array< IndexType >, _vector< IndexType > >( m, "Vector_int" );
    export_Vector< _array< RealType >, _vector< RealType > >( m, "Vector_float" );
    export_Vector< _array< ComplexType >, _vector< ComplexType > >( m, "Vector_complex" );
+   export_Array< _array< Float32Type > >( m, "Array_float32" );
+   export_Vector< _array< Float32Type >, _vector< Float32Type > >( m, "Vector_float32" );
+   export_Array< _array< Index32Type > >( m, "Array_int32" );
+   export_Vector< _array< Index32Type >, _vector< Index32Type > >( m, "Vector_int32" );
+   export_Array< _array< Float16Type > >( m, "Array_float16" );
+   export_Vector< _array< Float16Type >, _vector< Float16Type > >( m, "Vector_float16" );
+   export_Array< _array< BFloat16Type > >( m, "Array_bfloat16" );
+   export_Vector< _array< BFloat16Type >, _vector< BFloat16Type > >( m, "Vector_bfloat16" );
 
    export_Array< _array_view< bool > >( m, "ArrayView_bool" );
    export_Array< _array_view< IndexType > >( m, "ArrayView_int" );
@@ -35,6 +219,14 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array_view< IndexType >, _vector_view< IndexType > >( m, "VectorView_int" );
    export_Vector< _array_view< RealType >, _vector_view< RealType > >( m, "VectorView_float" );
    export_Vector< _array_view< ComplexType >, _vector_view< ComplexType > >( m, "VectorView_complex" );
+   export_Array< _array_view< Float32Type > >( m, "ArrayView_float32" );
+   export_Vector< _array_view< Float32Type >, _vector_view< Float32Type > >( m, "VectorView_float32" );
+   export_Array< _array_view< Index32Type > >( m, "ArrayView_int32" );
+   export_Vector< _array_view< Index32Type >, _vector_view< Index32Type > >( m, "VectorView_int32" );
+   export_Array< _array_view< Float16Type > >( m, "ArrayView_float16" );
+   export_Vector< _array_view< Float16Type >, _vector_view< Float16Type > >( m, "VectorView_float16" );
+   export_Array< _array_view< BFloat16Type > >( m, "ArrayView_bfloat16" );
+   export_Vector< _array_view< BFloat16Type >, _vector_view< BFloat16Type > >( m, "VectorView_bfloat16" );
 
    export_Array< _array_view< bool const > >( m, "ArrayView_bool_const" );
    export_Array< _array_view< IndexType const > >( m, "ArrayView_int_const" );
@@ -43,4 +235,37 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array_view< IndexType const >, _vector_view< IndexType const > >( m, "VectorView_int_const" );
    export_Vector< _array_view< RealType const >, _vector_view< RealType const > >( m, "VectorView_float_const" );
    export_Vector< _array_view< ComplexType const >, _vector_view< ComplexType const > >( m, "VectorView_complex_const" );
+   export_Array< _array_view< Float32Type const > >( m, "ArrayView_float32_const" );
+   export_Vector< _array_view< Float32Type const >, _vector_view< Float32Type const > >( m, "VectorView_float32_const" );
+   export_Array< _array_view< Index32Type const > >( m, "ArrayView_int32_const" );
+   export_Vector< _array_view< Index32Type const >, _vector_view< Index32Type const > >( m, "VectorView_int32_const" );
+   export_Array< _array_view< Float16Type const > >( m, "ArrayView_float16_const" );
+   export_Vector< _array_view< Float16Type const >, _vector_view< Float16Type const > >( m, "VectorView_float16_const" );
+   export_Array< _array_view< BFloat16Type const > >( m, "ArrayView_bfloat16_const" );
+   export_Vector< _array_view< BFloat16Type const >, _vector_view< BFloat16Type const > >( m, "VectorView_bfloat16_const" );
+
+   export_StridedArrayView< bool, TNL::Devices::Host >( m, "StridedArrayView_bool" );
+   export_StridedArrayView< IndexType, TNL::Devices::Host >( m, "StridedArrayView_int" );
+   export_StridedArrayView< RealType, TNL::Devices::Host >( m, "StridedArrayView_float" );
+   export_StridedArrayView< ComplexType, TNL::Devices::Host >( m, "StridedArrayView_complex" );
+   export_StridedArrayView< Float32Type, TNL::Devices::Host >( m, "StridedArrayView_float32" );
+   export_StridedArrayView< Index32Type, TNL::Devices::Host >( m, "StridedArrayView_int32" );
+   export_StridedArrayView< Float16Type, TNL::Devices::Host >( m, "StridedArrayView_float16" );
+   export_StridedArrayView< BFloat16Type, TNL::Devices::Host >( m, "StridedArrayView_bfloat16" );
+   export_StridedArrayView< bool const, TNL::Devices::Host >( m, "StridedArrayView_bool_const" );
+   export_StridedArrayView< IndexType const, TNL::Devices::Host >( m, "StridedArrayView_int_const" );
+   export_StridedArrayView< RealType const, TNL::Devices::Host >( m, "StridedArrayView_float_const" );
+   export_StridedArrayView< ComplexType const, TNL::Devices::Host >( m, "StridedArrayView_complex_const" );
+   export_StridedArrayView< Float32Type const, TNL::Devices::Host >( m, "StridedArrayView_float32_const" );
+   export_StridedArrayView< Index32Type const, TNL::Devices::Host >( m, "StridedArrayView_int32_const" );
+   export_StridedArrayView< Float16Type const, TNL::Devices::Host >( m, "StridedArrayView_float16_const" );
+   export_StridedArrayView< BFloat16Type const, TNL::Devices::Host >( m, "StridedArrayView_bfloat16_const" );
+
+   def_vector_functions< _vector< IndexType > >( m );
+   def_vector_functions< _vector< RealType > >( m );
+   def_vector_functions< _vector< ComplexType > >( m );
+   def_vector_functions< _vector< Float32Type > >( m );
+   def_vector_functions< _vector< Index32Type > >( m );
+   def_vector_functions< _vector< Float16Type > >( m );
+   def_vector_functions< _vector< BFloat16Type > >( m );
 }
@@ -2,6 +2,7 @@
 
 #include <pytnl/containers/Array.h>
 #include <pytnl/containers/Vector.h>
+#include <pytnl/containers/vector_functions.h>
 #include <pytnl/complex_caster.h>
 #include <TNL/Arithmetics/Complex.h>
 
@@ -32,6 +33,10 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array< IndexType >, _vector< IndexType > >( m, "Vector_int" );
    export_Vector< _array< RealType >, _vector< RealType > >( m, "Vector_float" );
    export_Vector< _array< ComplexType >, _vector< ComplexType > >( m, "Vector_complex" );
+   export_Array< _array< Float32Type > >( m, "Array_float32" );
+   export_Vector< _array< Float32Type >, _vector< Float32Type > >( m, "Vector_float32" );
+   export_Array< _array< Index32Type > >( m, "Array_int32" );
+   export_Vector< _array< Index32Type >, _vector< Index32Type > >( m, "Vector_int32" );
 
    export_Array< _array_view< bool > >( m, "ArrayView_bool" );
    export_Array< _array_view< IndexType > >( m, "ArrayView_int" );
@@ -40,6 +45,10 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array_view< IndexType >, _vector_view< IndexType > >( m, "VectorView_int" );
    export_Vector< _array_view< RealType >, _vector_view< RealType > >( m, "VectorView_float" );
    export_Vector< _array_view< ComplexType >, _vector_view< ComplexType > >( m, "VectorView_complex" );
+   export_Array< _array_view< Float32Type > >( m, "ArrayView_float32" );
+   export_Vector< _array_view< Float32Type >, _vector_view< Float32Type > >( m, "VectorView_float32" );
+   export_Array< _array_view< Index32Type > >( m, "ArrayView_int32" );
+   export_Vector< _array_view< Index32Type >, _vector_view< Index32Type > >( m, "VectorView_int32" );
 
    export_Array< _array_view< bool const > >( m, "ArrayView_bool_const" );
    export_Array< _array_view< IndexType const > >( m, "ArrayView_int_const" );
@@ -48,4 +57,27 @@ export_ArrayVector( nb::module_& m )
    export_Vector< _array_view< IndexType const >, _vector_view< IndexType const > >( m, "VectorView_int_const" );
    export_Vector< _array_view< RealType const >, _vector_view< RealType const > >( m, "VectorView_float_const" );
    export_Vector< _array_view< ComplexType const >, _vector_view< ComplexType const > >( m, "VectorView_complex_const" );
+   export_Array< _array_view< Float32Type const > >( m, "ArrayView_float32_const" );
+   export_Vector< _array_view< Float32Type const >, _vector_view< Float32Type const > >( m, "VectorView_float32_const" );
+   export_Array< _array_view< Index32Type const > >( m, "ArrayView_int32_const" );
+   export_Vector< _array_view< Index32Type const >, _vector_view< Index32Type const > >( m, "VectorView_int32_const" );
+
+   export_StridedArrayView< bool, TNL::Devices::Cuda >( m, "StridedArrayView_bool" );
+   export_StridedArrayView< IndexType, TNL::Devices::Cuda >( m, "StridedArrayView_int" );
+   export_StridedArrayView< RealType, TNL::Devices::Cuda >( m, "StridedArrayView_float" );
+   export_StridedArrayView< ComplexType, TNL::Devices::Cuda >( m, "StridedArrayView_complex" );
+   export_StridedArrayView< Float32Type, TNL::Devices::Cuda >( m, "StridedArrayView_float32" );
+   export_StridedArrayView< Index32Type, TNL::Devices::Cuda >( m, "StridedArrayView_int32" );
+   export_StridedArrayView< bool const, TNL::Devices::Cuda >( m, "StridedArrayView_bool_const" );
+   export_StridedArrayView< IndexType const, TNL::Devices::Cuda >( m, "StridedArrayView_int_const" );
+   export_StridedArrayView< RealType const, TNL::Devices::Cuda >( m, "StridedArrayView_float_const" );
+   export_StridedArrayView< ComplexType const, TNL::Devices::Cuda >( m, "StridedArrayView_complex_const" );
+   export_StridedArrayView< Float32Type const, TNL::Devices::Cuda >( m, "StridedArrayView_float32_const" );
+   export_StridedArrayView< Index32Type const, TNL::Devices::Cuda >( m, "StridedArrayView_int32_const" );
+
+   def_vector_functions< _vector< IndexType > >( m );
+   def_vector_functions< _vector< RealType > >( m );
+   def_vector_functions< _vector< ComplexType > >( m );
+   def_vector_functions< _vector< Float32Type > >( m );
+   def_vector_functions< _vector< Index32Type > >( m );
 }
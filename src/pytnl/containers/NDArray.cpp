@@ -20,9 +20,9 @@ using _ndarray = NDArray<
    std::make_index_sequence< dim >,  // identity by default
    TNL::Devices::Host,
    IndexType,
-   make_sizes_holder< IndexType, dim >  // all overlaps are set at runtime
+   make_sizes_holder< IndexType, dim >,  // all overlaps are set at runtime
    //ConstStaticSizesHolder< IndexType, dim, 0 >  // ConstStaticSizesHolder does not have Python bindings
-   >;
+   pytnl::Allocator< T, TNL::Devices::Host > >;
 
 template< int dim, typename T >
 using _ndarray_view = typename _ndarray< dim, T >::ViewType;
@@ -55,6 +55,15 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray< 1, ComplexType > >( m, "NDArray_1_complex" );
    export_NDArray< _ndarray< 2, ComplexType > >( m, "NDArray_2_complex" );
    export_NDArray< _ndarray< 3, ComplexType > >( m, "NDArray_3_complex" );
+   export_NDArray< _ndarray< 1, Float32Type > >( m, "NDArray_1_float32" );
+   export_NDArray< _ndarray< 2, Float32Type > >( m, "NDArray_2_float32" );
+   export_NDArray< _ndarray< 3, Float32Type > >( m, "NDArray_3_float32" );
+   export_NDArray< _ndarray< 1, Float16Type > >( m, "NDArray_1_float16" );
+   export_NDArray< _ndarray< 2, Float16Type > >( m, "NDArray_2_float16" );
+   export_NDArray< _ndarray< 3, Float16Type > >( m, "NDArray_3_float16" );
+   export_NDArray< _ndarray< 1, BFloat16Type > >( m, "NDArray_1_bfloat16" );
+   export_NDArray< _ndarray< 2, BFloat16Type > >( m, "NDArray_2_bfloat16" );
+   export_NDArray< _ndarray< 3, BFloat16Type > >( m, "NDArray_3_bfloat16" );
 
    export_NDArray< _ndarray_view< 1, IndexType > >( m, "NDArrayView_1_int" );
    export_NDArray< _ndarray_view< 2, IndexType > >( m, "NDArrayView_2_int" );
@@ -65,6 +74,15 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray_view< 1, ComplexType > >( m, "NDArrayView_1_complex" );
    export_NDArray< _ndarray_view< 2, ComplexType > >( m, "NDArrayView_2_complex" );
    export_NDArray< _ndarray_view< 3, ComplexType > >( m, "NDArrayView_3_complex" );
+   export_NDArray< _ndarray_view< 1, Float32Type > >( m, "NDArrayView_1_float32" );
+   export_NDArray< _ndarray_view< 2, Float32Type > >( m, "NDArrayView_2_float32" );
+   export_NDArray< _ndarray_view< 3, Float32Type > >( m, "NDArrayView_3_float32" );
+   export_NDArray< _ndarray_view< 1, Float16Type > >( m, "NDArrayView_1_float16" );
+   export_NDArray< _ndarray_view< 2, Float16Type > >( m, "NDArrayView_2_float16" );
+   export_NDArray< _ndarray_view< 3, Float16Type > >( m, "NDArrayView_3_float16" );
+   export_NDArray< _ndarray_view< 1, BFloat16Type > >( m, "NDArrayView_1_bfloat16" );
+   export_NDArray< _ndarray_view< 2, BFloat16Type > >( m, "NDArrayView_2_bfloat16" );
+   export_NDArray< _ndarray_view< 3, BFloat16Type > >( m, "NDArrayView_3_bfloat16" );
 
    export_NDArray< _ndarray_const_view< 1, IndexType > >( m, "NDArrayView_1_int_const" );
    export_NDArray< _ndarray_const_view< 2, IndexType > >( m, "NDArrayView_2_int_const" );
@@ -75,6 +93,15 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray_const_view< 1, ComplexType > >( m, "NDArrayView_1_complex_const" );
    export_NDArray< _ndarray_const_view< 2, ComplexType > >( m, "NDArrayView_2_complex_const" );
    export_NDArray< _ndarray_const_view< 3, ComplexType > >( m, "NDArrayView_3_complex_const" );
+   export_NDArray< _ndarray_const_view< 1, Float32Type > >( m, "NDArrayView_1_float32_const" );
+   export_NDArray< _ndarray_const_view< 2, Float32Type > >( m, "NDArrayView_2_float32_const" );
+   export_NDArray< _ndarray_const_view< 3, Float32Type > >( m, "NDArrayView_3_float32_const" );
+   export_NDArray< _ndarray_const_view< 1, Float16Type > >( m, "NDArrayView_1_float16_const" );
+   export_NDArray< _ndarray_const_view< 2, Float16Type > >( m, "NDArrayView_2_float16_const" );
+   export_NDArray< _ndarray_const_view< 3, Float16Type > >( m, "NDArrayView_3_float16_const" );
+   export_NDArray< _ndarray_const_view< 1, BFloat16Type > >( m, "NDArrayView_1_bfloat16_const" );
+   export_NDArray< _ndarray_const_view< 2, BFloat16Type > >( m, "NDArrayView_2_bfloat16_const" );
+   export_NDArray< _ndarray_const_view< 3, BFloat16Type > >( m, "NDArrayView_3_bfloat16_const" );
 
    export_DistributedNDArray< _distributed_ndarray< 1, IndexType > >( m, "DistributedNDArray_1_int" );
    export_DistributedNDArray< _distributed_ndarray< 2, IndexType > >( m, "DistributedNDArray_2_int" );
@@ -42,6 +42,9 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray< 1, ComplexType > >( m, "NDArray_1_complex" );
    export_NDArray< _ndarray< 2, ComplexType > >( m, "NDArray_2_complex" );
    export_NDArray< _ndarray< 3, ComplexType > >( m, "NDArray_3_complex" );
+   export_NDArray< _ndarray< 1, Float32Type > >( m, "NDArray_1_float32" );
+   export_NDArray< _ndarray< 2, Float32Type > >( m, "NDArray_2_float32" );
+   export_NDArray< _ndarray< 3, Float32Type > >( m, "NDArray_3_float32" );
 
    export_NDArray< _ndarray_view< 1, IndexType > >( m, "NDArrayView_1_int" );
    export_NDArray< _ndarray_view< 2, IndexType > >( m, "NDArrayView_2_int" );
@@ -52,6 +55,9 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray_view< 1, ComplexType > >( m, "NDArrayView_1_complex" );
    export_NDArray< _ndarray_view< 2, ComplexType > >( m, "NDArrayView_2_complex" );
    export_NDArray< _ndarray_view< 3, ComplexType > >( m, "NDArrayView_3_complex" );
+   export_NDArray< _ndarray_view< 1, Float32Type > >( m, "NDArrayView_1_float32" );
+   export_NDArray< _ndarray_view< 2, Float32Type > >( m, "NDArrayView_2_float32" );
+   export_NDArray< _ndarray_view< 3, Float32Type > >( m, "NDArrayView_3_float32" );
 
    export_NDArray< _ndarray_view< 1, IndexType const > >( m, "NDArrayView_1_int_const" );
    export_NDArray< _ndarray_view< 2, IndexType const > >( m, "NDArrayView_2_int_const" );
@@ -62,6 +68,9 @@ export_NDArray( nb::module_& m )
    export_NDArray< _ndarray_view< 1, ComplexType const > >( m, "NDArrayView_1_complex_const" );
    export_NDArray< _ndarray_view< 2, ComplexType const > >( m, "NDArrayView_2_complex_const" );
    export_NDArray< _ndarray_view< 3, ComplexType const > >( m, "NDArrayView_3_complex_const" );
+   export_NDArray< _ndarray_view< 1, Float32Type const > >( m, "NDArrayView_1_float32_const" );
+   export_NDArray< _ndarray_view< 2, Float32Type const > >( m, "NDArrayView_2_float32_const" );
+   export_NDArray< _ndarray_view< 3, Float32Type const > >( m, "NDArrayView_3_float32_const" );
 
    export_DistributedNDArray< _distributed_ndarray< 1, IndexType > >( m, "DistributedNDArray_1_int" );
    export_DistributedNDArray< _distributed_ndarray< 2, IndexType > >( m, "DistributedNDArray_2_int" );
@@ -2,10 +2,31 @@ from __future__ import annotations
 
 from typing import TYPE_CHECKING, Any, Literal, overload
 
+import numpy as np
+
 import pytnl._containers
 import pytnl._meta
 import pytnl.devices
-from pytnl._meta import DIMS, DT, VT
+from pytnl._containers import (
+    BitArray,
+    CachingAllocator,
+    HugePages,
+    NumaPolicy,
+    ScanOperation,
+    abs,
+    add,
+    axpby,
+    axpy,
+    div,
+    isCopyOnWrite,
+    mul,
+    neg,
+    setCopyOnWrite,
+    sub,
+)
+from pytnl._meta import DIMS, DT, VT, bfloat16
+from pytnl.containers.dlpack import from_dlpack
+from pytnl.containers.expressions import Expression, lazy
 
 if TYPE_CHECKING:
     # This is an optional module - at runtime it is lazy-imported in
@@ -15,13 +36,32 @@ if TYPE_CHECKING:
 __all__ = [
     "Array",
     "ArrayView",
+    "BitArray",
+    "CachingAllocator",
     "DistributedNDArray",
+    "Expression",
+    "HugePages",
     "NDArray",
     "NDArrayIndexer",
     "NDArrayView",
+    "NumaPolicy",
+    "ScanOperation",
     "StaticVector",
     "Vector",
     "VectorView",
+    # `abs` is not exported, `from pytnl.containers import *` would shadow the builtin
+    "add",
+    "axpby",
+    "axpy",
+    "bfloat16",
+    "div",
+    "from_dlpack",
+    "isCopyOnWrite",
+    "lazy",
+    "mul",
+    "neg",
+    "setCopyOnWrite",
+    "sub",
 ]
 
 
@@ -67,6 +107,34 @@ class _ArrayMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.Array_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float32] | tuple[type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Array_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float16] | tuple[type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Array_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[bfloat16] | tuple[type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Array_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.int32] | tuple[type[np.int32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Array_int32]: ...
+
     @overload
     def __getitem__(  # type: ignore[overload-overlap, no-any-unimported, unused-ignore]
         self,
@@ -95,6 +163,20 @@ class _ArrayMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.Array_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.Array_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.int32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.Array_int32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: type[bool | VT] | tuple[type[bool | VT], type[DT]],
@@ -167,6 +249,34 @@ class _ArrayViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.ArrayView_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float32] | tuple[type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.ArrayView_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float16] | tuple[type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.ArrayView_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[bfloat16] | tuple[type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.ArrayView_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.int32] | tuple[type[np.int32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.ArrayView_int32]: ...
+
     @overload
     def __getitem__(  # type: ignore[overload-overlap, no-any-unimported, unused-ignore]
         self,
@@ -195,6 +305,20 @@ class _ArrayViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.ArrayView_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.ArrayView_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.int32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.ArrayView_int32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: type[bool | VT] | tuple[type[bool | VT], type[DT]],
@@ -260,6 +384,34 @@ class _VectorMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.Vector_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float32] | tuple[type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Vector_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float16] | tuple[type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Vector_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[bfloat16] | tuple[type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Vector_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.int32] | tuple[type[np.int32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.Vector_int32]: ...
+
     @overload
     def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
         self,
@@ -281,6 +433,20 @@ class _VectorMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.Vector_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.Vector_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.int32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.Vector_int32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: type[VT] | tuple[type[VT], type[DT]],
@@ -308,6 +474,8 @@ class Vector(metaclass=_VectorMeta):
     - `Vector[int]` → `_containers.Vector_int`
     - `Vector[float, devices.Cuda]` → `_containers_cuda.Vector_float`
     - `Vector[complex, devices.Host]` → `_containers.Vector_complex`
+    - `Vector[np.float32]` → `_containers.Vector_float32`
+    - `Vector[np.float16]` → `_containers.Vector_float16` (host only, computed in float)
     """
 
 
@@ -444,6 +612,34 @@ class _VectorViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.VectorView_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float32] | tuple[type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.VectorView_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.float16] | tuple[type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.VectorView_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[bfloat16] | tuple[type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.VectorView_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[np.int32] | tuple[type[np.int32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.VectorView_int32]: ...
+
     @overload
     def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
         self,
@@ -465,6 +661,20 @@ class _VectorViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.VectorView_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.VectorView_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[np.int32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.VectorView_int32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: type[VT] | tuple[type[VT], type[DT]],
@@ -573,6 +783,69 @@ class _NDArrayMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.NDArray_3_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[np.float32]] | tuple[Literal[1], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_1_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[np.float16]] | tuple[Literal[1], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_1_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[bfloat16]] | tuple[Literal[1], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_1_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[np.float32]] | tuple[Literal[2], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_2_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[np.float16]] | tuple[Literal[2], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_2_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[bfloat16]] | tuple[Literal[2], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_2_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[np.float32]] | tuple[Literal[3], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_3_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[np.float16]] | tuple[Literal[3], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_3_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[bfloat16]] | tuple[Literal[3], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArray_3_bfloat16]: ...
+
     @overload
     def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
         self,
@@ -636,6 +909,27 @@ class _NDArrayMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.NDArray_3_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[1], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArray_1_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[2], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArray_2_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[3], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArray_3_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: tuple[DIMS, type[VT]] | tuple[DIMS, type[VT], type[DT]],
@@ -742,6 +1036,69 @@ class _NDArrayViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[pytnl._containers.NDArrayView_3_complex]: ...
 
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[np.float32]] | tuple[Literal[1], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_1_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[np.float16]] | tuple[Literal[1], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_1_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[1], type[bfloat16]] | tuple[Literal[1], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_1_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[np.float32]] | tuple[Literal[2], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_2_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[np.float16]] | tuple[Literal[2], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_2_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[2], type[bfloat16]] | tuple[Literal[2], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_2_bfloat16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[np.float32]] | tuple[Literal[3], type[np.float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_3_float32]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[np.float16]] | tuple[Literal[3], type[np.float16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_3_float16]: ...
+
+    @overload
+    def __getitem__(
+        self,
+        key: tuple[Literal[3], type[bfloat16]] | tuple[Literal[3], type[bfloat16], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._containers.NDArrayView_3_bfloat16]: ...
+
     @overload
     def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
         self,
@@ -805,6 +1162,27 @@ class _NDArrayViewMeta(pytnl._meta.CPPClassTemplate):
         /,
     ) -> type[_containers_cuda.NDArrayView_3_complex]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[1], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArrayView_1_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[2], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArrayView_2_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[Literal[3], type[np.float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_containers_cuda.NDArrayView_3_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(
         self,
         key: tuple[DIMS, type[VT]] | tuple[DIMS, type[VT], type[DT]],
@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -7,13 +9,18 @@ void
 export_StaticVector( nb::module_& m );
 void
 export_NDArray( nb::module_& m );
+void
+export_expressions( nb::module_& m );
 
 // Python module definition
 NB_MODULE( _containers, m )
 {
    register_exceptions( m );
+   register_host_device( m );
+   export_caching_pool( m );
 
    export_ArrayVector( m );
    export_StaticVector( m );
    export_NDArray( m );
+   export_expressions( m );
 }
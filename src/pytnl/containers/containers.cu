@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -10,9 +12,11 @@ export_NDArray( nb::module_& m );
 NB_MODULE( _containers_cuda, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers" );
+   import_caching_pool();
 
    export_ArrayVector( m );
    export_NDArray( m );
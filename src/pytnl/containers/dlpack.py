@@ -0,0 +1,130 @@
+"""
+Zero-copy import of memory owned by other Python libraries.
+
+The view classes (`ArrayView`, `VectorView`, `NDArrayView`) can be constructed
+directly from a C-contiguous NumPy array (or any object supporting DLPack or
+the buffer protocol) of the matching dtype, e.g. `VectorView[float](a)`. The
+`from_dlpack` function selects the view class automatically:
+
+    >>> import numpy as np
+    >>> from pytnl.containers import from_dlpack
+    >>> a = np.zeros(10)
+    >>> v = from_dlpack(a)   # VectorView_float sharing memory with `a`
+    >>> v[0] = 1
+    >>> a[0]
+    np.float64(1.0)
+
+The views keep the exporting object alive, but the exporter must not
+reallocate its memory while the view is in use.
+"""
+
+from __future__ import annotations
+
+import importlib
+from types import ModuleType
+from typing import Protocol
+
+import pytnl._containers as _containers
+
+__all__ = [
+    "from_dlpack",
+]
+
+# DLPack device types (DLDeviceType in dlpack.h)
+_DL_CPU = 1
+_DL_CUDA = 2
+
+# one-dimensional arrays are imported as vectors (except bool), the classes
+# missing in a module (e.g. half precision in the CUDA module) are skipped
+_VIEW_CLASS_NAMES = (
+    *(f"VectorView_{value_type}" for value_type in ("int", "float", "complex", "float32", "int32", "float16", "bfloat16")),
+    "ArrayView_bool",
+    *(f"NDArrayView_{dim}_{value_type}" for dim in (2, 3) for value_type in ("int", "float", "complex", "float32", "float16", "bfloat16")),
+)
+
+type HostView = (
+    _containers.ArrayView_bool
+    | _containers.ArrayView_bool_const
+    | _containers.VectorView_int
+    | _containers.VectorView_int_const
+    | _containers.VectorView_float
+    | _containers.VectorView_float_const
+    | _containers.VectorView_complex
+    | _containers.VectorView_complex_const
+    | _containers.VectorView_float32
+    | _containers.VectorView_float32_const
+    | _containers.VectorView_int32
+    | _containers.VectorView_int32_const
+    | _containers.VectorView_float16
+    | _containers.VectorView_float16_const
+    | _containers.VectorView_bfloat16
+    | _containers.VectorView_bfloat16_const
+    | _containers.NDArrayView_2_int
+    | _containers.NDArrayView_2_int_const
+    | _containers.NDArrayView_2_float
+    | _containers.NDArrayView_2_float_const
+    | _containers.NDArrayView_2_complex
+    | _containers.NDArrayView_2_complex_const
+    | _containers.NDArrayView_2_float32
+    | _containers.NDArrayView_2_float32_const
+    | _containers.NDArrayView_2_float16
+    | _containers.NDArrayView_2_float16_const
+    | _containers.NDArrayView_2_bfloat16
+    | _containers.NDArrayView_2_bfloat16_const
+    | _containers.NDArrayView_3_int
+    | _containers.NDArrayView_3_int_const
+    | _containers.NDArrayView_3_float
+    | _containers.NDArrayView_3_float_const
+    | _containers.NDArrayView_3_complex
+    | _containers.NDArrayView_3_complex_const
+    | _containers.NDArrayView_3_float32
+    | _containers.NDArrayView_3_float32_const
+    | _containers.NDArrayView_3_float16
+    | _containers.NDArrayView_3_float16_const
+    | _containers.NDArrayView_3_bfloat16
+    | _containers.NDArrayView_3_bfloat16_const
+)
+
+
+class SupportsDLPack(Protocol):
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
+
+def _module_for_device(device_type: int) -> ModuleType:
+    if device_type == _DL_CPU:
+        return _containers
+    if device_type == _DL_CUDA:
+        return importlib.import_module("pytnl._containers_cuda")
+    raise ValueError(f"unsupported DLPack device type {device_type}")
+
+
+def from_dlpack(x: SupportsDLPack, *, readonly: bool = False) -> HostView:
+    """
+    Returns a view of the memory of `x` without copying the data.
+
+    One-dimensional arrays are imported as `VectorView` (or `ArrayView` for
+    bool), two- and three-dimensional arrays as `NDArrayView`. The array
+    must be C-contiguous and its dtype must be `bool`, `int64`, `float64`,
+    `complex128`, `float32`, `float16` or `bfloat16`, or `int32` for
+    one-dimensional arrays. Read-only arrays are imported as constant views,
+    which can also be requested explicitly with `readonly=True`.
+
+    Arrays in GPU memory are imported as views from `pytnl._containers_cuda`
+    (the return type annotation covers only the host views).
+
+    Raises `TypeError` if `x` cannot be wrapped in any view class.
+    """
+    device_type, _ = x.__dlpack_device__()
+    module = _module_for_device(device_type)
+
+    suffixes = ("_const",) if readonly else ("", "_const")
+    for suffix in suffixes:
+        for name in _VIEW_CLASS_NAMES:
+            view_class = getattr(module, name + suffix, None)
+            if view_class is None:
+                continue
+            try:
+                return view_class(x)  # type: ignore[no-any-return]
+            except TypeError:
+                continue
+    raise TypeError(f"cannot create a zero-copy view of {type(x).__name__}: the array must be C-contiguous with a supported dtype")
@@ -0,0 +1,17 @@
+#include <pytnl/pytnl.h>
+
+#include <pytnl/containers/expressions.h>
+
+using namespace TNL::Containers;
+
+template< typename T >
+using _vector = pytnl::Vector< T, TNL::Devices::Host, IndexType >;
+
+void
+export_expressions( nb::module_& m )
+{
+   export_expression_enums( m );
+   export_expressions< _vector< IndexType > >( m );
+   export_expressions< _vector< RealType > >( m );
+   export_expressions< _vector< ComplexType > >( m );
+}
@@ -0,0 +1,343 @@
+"""
+Lazily evaluated element-wise expressions on host vectors.
+
+Each arithmetic operator on PyTNL vectors evaluates its result immediately, so
+an expression such as `a * b + c * d` traverses the memory several times and
+allocates a temporary vector for every operator. Wrapping one of the operands
+with `lazy` builds an `Expression` object instead, which is evaluated only when
+its value is requested -- with one pass over the operands and without any
+temporaries:
+
+    >>> from pytnl.containers import Vector, lazy
+    >>> a, b, c, d = (Vector[float](1000, i) for i in range(4))
+    >>> e = lazy(a) * b + c * d      # nothing is computed yet
+    >>> result = e.eval()            # new vector
+    >>> e.eval(out=a)                # evaluation into an existing vector
+    >>> total = e.sum()              # reduction without materializing `e`
+
+Note that Python evaluates the operators from left to right, so each
+sub-expression that does not contain an `Expression` operand (such as `c * d`
+above) is still evaluated eagerly. Use `lazy(c) * d` to make it lazy as well.
+"""
+
+from __future__ import annotations
+
+import math
+from collections.abc import Sequence
+
+import pytnl._containers
+
+__all__ = [
+    "Expression",
+    "cos",
+    "exp",
+    "lazy",
+    "log",
+    "maximum",
+    "minimum",
+    "sin",
+    "sqrt",
+]
+
+_Opcode = pytnl._containers._ExpressionOpcode
+_Reduction = pytnl._containers._ExpressionReduction
+
+type Scalar = int | float | complex
+
+# Vector types which can be used as operands
+type VectorLike = (
+    pytnl._containers.Vector_int
+    | pytnl._containers.Vector_float
+    | pytnl._containers.Vector_complex
+    | pytnl._containers.VectorView_int
+    | pytnl._containers.VectorView_float
+    | pytnl._containers.VectorView_complex
+    | pytnl._containers.VectorView_int_const
+    | pytnl._containers.VectorView_float_const
+    | pytnl._containers.VectorView_complex_const
+)
+
+type Operand = Expression | VectorLike | Scalar
+
+# Value types of the vector types which can be used as operands
+_VECTOR_TYPES: dict[type[VectorLike], type[Scalar]] = {
+    getattr(pytnl._containers, f"{prefix}_{value_type.__name__}{suffix}"): value_type
+    for value_type in (int, float, complex)
+    for prefix in ("Vector", "VectorView")
+    for suffix in ("", "_const")
+}
+
+# Scalar types which can be combined with vectors of given value type
+_SCALAR_TYPES: dict[type[Scalar], tuple[type[Scalar], ...]] = {
+    int: (int,),
+    float: (int, float),
+    complex: (int, float, complex),
+}
+
+
+class Expression:
+    """
+    Lazily evaluated element-wise expression on host vectors.
+
+    The expression is stored as a program in postfix notation, which is
+    interpreted block-wise in C++ when the expression is evaluated. Operand
+    vectors are referenced, not copied, so modifying an operand before the
+    evaluation affects the result.
+    """
+
+    __slots__ = ("_code", "_scalars", "_value_type", "_vectors")
+
+    def __init__(
+        self,
+        code: Sequence[tuple[pytnl._containers._ExpressionOpcode, int]],
+        vectors: Sequence[VectorLike],
+        scalars: Sequence[Scalar],
+        value_type: type[Scalar],
+    ) -> None:
+        self._code = list(code)
+        self._vectors = list(vectors)
+        self._scalars = list(scalars)
+        self._value_type = value_type
+
+    @property
+    def value_type(self) -> type[Scalar]:
+        """Value type of the expression (`int`, `float`, or `complex`)."""
+        return self._value_type
+
+    def __len__(self) -> int:
+        return self._vectors[0].getSize()
+
+    def __repr__(self) -> str:
+        return f"<Expression of {len(self._vectors)} vector(s) and {len(self._scalars)} scalar(s), size {len(self)}>"
+
+    # Construction of expressions
+
+    def _operand(self, other: object) -> Expression:
+        if isinstance(other, Expression):
+            if other._value_type is not self._value_type:
+                raise TypeError(
+                    f"cannot combine expressions with value types {self._value_type.__name__} "
+                    f"and {other._value_type.__name__}"
+                )
+            return other
+        if type(other) in _VECTOR_TYPES:
+            if _VECTOR_TYPES[type(other)] is not self._value_type:
+                raise TypeError(
+                    f"cannot combine an expression with value type {self._value_type.__name__} "
+                    f"and {type(other).__name__}"
+                )
+            return lazy(other)
+        if isinstance(other, _SCALAR_TYPES[self._value_type]):
+            return Expression([(_Opcode.SCALAR, 0)], [], [other], self._value_type)
+        raise TypeError(f"unsupported operand type for an expression: {type(other).__name__}")
+
+    def _binary(self, op: pytnl._containers._ExpressionOpcode, other: object, reflected: bool = False) -> Expression:
+        rhs = self._operand(other)
+        lhs = self
+        if reflected:
+            lhs, rhs = rhs, lhs
+        code = list(lhs._code)
+        for opcode, index in rhs._code:
+            if opcode == _Opcode.VECTOR:
+                index += len(lhs._vectors)
+            elif opcode == _Opcode.SCALAR:
+                index += len(lhs._scalars)
+            code.append((opcode, index))
+        code.append((op, 0))
+        return Expression(code, lhs._vectors + rhs._vectors, lhs._scalars + rhs._scalars, self._value_type)
+
+    def _operator(self, op: pytnl._containers._ExpressionOpcode, other: object, reflected: bool = False) -> Expression:
+        try:
+            return self._binary(op, other, reflected)
+        except TypeError:
+            return NotImplemented
+
+    def _unary(self, op: pytnl._containers._ExpressionOpcode) -> Expression:
+        return Expression([*self._code, (op, 0)], self._vectors, self._scalars, self._value_type)
+
+    def __add__(self, other: object) -> Expression:
+        return self._operator(_Opcode.ADD, other)
+
+    def __radd__(self, other: object) -> Expression:
+        return self._operator(_Opcode.ADD, other, reflected=True)
+
+    def __sub__(self, other: object) -> Expression:
+        return self._operator(_Opcode.SUB, other)
+
+    def __rsub__(self, other: object) -> Expression:
+        return self._operator(_Opcode.SUB, other, reflected=True)
+
+    def __mul__(self, other: object) -> Expression:
+        return self._operator(_Opcode.MUL, other)
+
+    def __rmul__(self, other: object) -> Expression:
+        return self._operator(_Opcode.MUL, other, reflected=True)
+
+    def __truediv__(self, other: object) -> Expression:
+        return self._operator(_Opcode.DIV, other)
+
+    def __rtruediv__(self, other: object) -> Expression:
+        return self._operator(_Opcode.DIV, other, reflected=True)
+
+    def __neg__(self) -> Expression:
+        return self._unary(_Opcode.NEG)
+
+    def __pos__(self) -> Expression:
+        return self
+
+    def __abs__(self) -> Expression:
+        return self._unary(_Opcode.ABS)
+
+    # Evaluation
+
+    def _arguments(self) -> tuple[list[tuple[pytnl._containers._ExpressionOpcode, int]], list[VectorLike], list[Scalar]]:
+        vectors = [v.getConstView() for v in self._vectors]
+        return self._code, vectors, self._scalars
+
+    def eval(self, out: VectorLike | None = None) -> VectorLike:
+        """
+        Evaluates the expression in one pass over the operands.
+
+        If `out` is `None`, the result is returned as a new vector. Otherwise
+        `out` must be a vector or vector view of the same value type and size
+        as the expression, the result is written into it and `out` is returned.
+        `out` may be one of the operands of the expression.
+        """
+        if out is None:
+            return pytnl._containers._expression_evaluate(*self._arguments())
+        if _VECTOR_TYPES.get(type(out)) is not self._value_type or type(out).__name__.endswith("_const"):
+            raise TypeError(f"cannot evaluate an expression with value type {self._value_type.__name__} into {type(out).__name__}")
+        pytnl._containers._expression_evaluate(*self._arguments(), out=out.getView())
+        return out
+
+    def sum(self) -> Scalar:
+        """Returns the sum of all elements of the expression."""
+        return pytnl._containers._expression_reduce(*self._arguments(), reduction=_Reduction.SUM)
+
+    def product(self) -> Scalar:
+        """Returns the product of all elements of the expression."""
+        return pytnl._containers._expression_reduce(*self._arguments(), reduction=_Reduction.PRODUCT)
+
+    def min(self) -> Scalar:
+        """Returns the minimum of all elements of the expression (not defined for complex values)."""
+        return pytnl._containers._expression_reduce(*self._arguments(), reduction=_Reduction.MIN)
+
+    def max(self) -> Scalar:
+        """Returns the maximum of all elements of the expression (not defined for complex values)."""
+        return pytnl._containers._expression_reduce(*self._arguments(), reduction=_Reduction.MAX)
+
+    def l1Norm(self) -> int | float:
+        """Returns the sum of absolute values of all elements of the expression."""
+        return pytnl._containers._expression_reduce_norm(*self._arguments(), reduction=_Reduction.ABS_SUM)
+
+    def l2Norm(self) -> float:
+        """Returns the Euclidean norm of the expression."""
+        squared = pytnl._containers._expression_reduce_norm(*self._arguments(), reduction=_Reduction.SQUARED_ABS_SUM)
+        return math.sqrt(squared)
+
+    def maxNorm(self) -> int | float:
+        """Returns the maximum of absolute values of all elements of the expression."""
+        return pytnl._containers._expression_reduce_norm(*self._arguments(), reduction=_Reduction.ABS_MAX)
+
+    def lpNorm(self, p: float) -> float:
+        """
+        Returns the lp-norm of the expression for `p >= 1`.
+
+        Only the orders 1, 2 and infinity are fused, other orders evaluate
+        the expression into a temporary vector first.
+        """
+        if p == 1:
+            return float(self.l1Norm())
+        if p == 2:
+            return self.l2Norm()
+        if p == math.inf:
+            return float(self.maxNorm())
+        return self.eval().lpNorm(p)
+
+    def dot(self, other: Operand) -> Scalar:
+        """Returns the dot product `sum(self * other)` without evaluating the product."""
+        return self._binary(_Opcode.MUL, other).sum()
+
+    # Reductions which are not fused (the expression is evaluated first)
+
+    def _eval_ordered(self) -> pytnl._containers.Vector_int | pytnl._containers.Vector_float:
+        result = self.eval()
+        if isinstance(result, pytnl._containers.Vector_int | pytnl._containers.Vector_float):
+            return result
+        raise TypeError("the reduction is not defined for complex values")
+
+    def argMin(self) -> tuple[int | float, int]:
+        """Returns a tuple `(value, index)` of the minimum and the index of its first occurrence."""
+        return self._eval_ordered().argMin()
+
+    def argMax(self) -> tuple[int | float, int]:
+        """Returns a tuple `(value, index)` of the maximum and the index of its first occurrence."""
+        return self._eval_ordered().argMax()
+
+    def any(self) -> bool:
+        """Returns `True` if any element of the expression is non-zero."""
+        return self.eval().any()
+
+    def all(self) -> bool:
+        """Returns `True` if all elements of the expression are non-zero."""
+        return self.eval().all()
+
+
+def lazy(vector: Expression | VectorLike) -> Expression:
+    """
+    Wraps a host vector or vector view in an `Expression`, so that all
+    operations with it are evaluated lazily.
+    """
+    if isinstance(vector, Expression):
+        return vector
+    value_type = _VECTOR_TYPES.get(type(vector))
+    if value_type is None:
+        raise TypeError(f"expected a host vector or vector view, got {type(vector).__name__}")
+    return Expression([(_Opcode.VECTOR, 0)], [vector], [], value_type)
+
+
+def _apply(op: pytnl._containers._ExpressionOpcode, operand: Expression | VectorLike) -> Expression:
+    return lazy(operand)._unary(op)
+
+
+def _combine(op: pytnl._containers._ExpressionOpcode, a: Operand, b: Operand) -> Expression:
+    if isinstance(a, Expression) or type(a) in _VECTOR_TYPES:
+        return lazy(a)._binary(op, b)
+    if isinstance(b, Expression) or type(b) in _VECTOR_TYPES:
+        return lazy(b)._binary(op, a, reflected=True)
+    raise TypeError("at least one operand must be a vector or an expression")
+
+
+def minimum(a: Operand, b: Operand) -> Expression:
+    """Element-wise minimum of two operands (not defined for complex values)."""
+    return _combine(_Opcode.MIN, a, b)
+
+
+def maximum(a: Operand, b: Operand) -> Expression:
+    """Element-wise maximum of two operands (not defined for complex values)."""
+    return _combine(_Opcode.MAX, a, b)
+
+
+def sqrt(operand: Expression | VectorLike) -> Expression:
+    """Element-wise square root (floating-point and complex values only)."""
+    return _apply(_Opcode.SQRT, operand)
+
+
+def exp(operand: Expression | VectorLike) -> Expression:
+    """Element-wise exponential (floating-point and complex values only)."""
+    return _apply(_Opcode.EXP, operand)
+
+
+def log(operand: Expression | VectorLike) -> Expression:
+    """Element-wise natural logarithm (floating-point and complex values only)."""
+    return _apply(_Opcode.LOG, operand)
+
+
+def sin(operand: Expression | VectorLike) -> Expression:
+    """Element-wise sine (floating-point and complex values only)."""
+    return _apply(_Opcode.SIN, operand)
+
+
+def cos(operand: Expression | VectorLike) -> Expression:
+    """Element-wise cosine (floating-point and complex values only)."""
+    return _apply(_Opcode.COS, operand)
@@ -0,0 +1,156 @@
+"""
+Parallel reductions of vectors and lazy expressions.
+
+The functions in this module call the reduction methods of their argument,
+which may be a vector, a vector view, or an `Expression`. Reductions of
+expressions are evaluated in one pass over the operands, so for example the
+norm of a difference does not allocate a temporary vector:
+
+    >>> from pytnl.containers import Vector, lazy, reductions
+    >>> a, b = Vector[float](1000, 1.0), Vector[float](1000, 2.0)
+    >>> reductions.l2Norm(lazy(a) - b)   # fused, no temporary
+    >>> reductions.l2Norm(a - b)         # evaluates `a - b` first
+    >>> reductions.dot(a, b)
+
+Note that some functions of this module shadow Python builtins (`sum`, `min`,
+`max`, `any`, `all`), so it is best imported as a module rather than with
+`from pytnl.containers.reductions import *`.
+"""
+
+from __future__ import annotations
+
+from typing import Protocol
+
+__all__ = [
+    "all",
+    "any",
+    "argMax",
+    "argMin",
+    "dot",
+    "l1Norm",
+    "l2Norm",
+    "lpNorm",
+    "max",
+    "maxNorm",
+    "min",
+    "product",
+    "sum",
+]
+
+
+class _Sum[T](Protocol):
+    def sum(self) -> T: ...
+
+
+class _Product[T](Protocol):
+    def product(self) -> T: ...
+
+
+class _Min[T](Protocol):
+    def min(self) -> T: ...
+
+
+class _Max[T](Protocol):
+    def max(self) -> T: ...
+
+
+class _ArgMin[T](Protocol):
+    def argMin(self) -> tuple[T, int]: ...
+
+
+class _ArgMax[T](Protocol):
+    def argMax(self) -> tuple[T, int]: ...
+
+
+class _Dot[T, U](Protocol):
+    def dot(self, other: U, /) -> T: ...
+
+
+class _L1Norm[T](Protocol):
+    def l1Norm(self) -> T: ...
+
+
+class _L2Norm(Protocol):
+    def l2Norm(self) -> float: ...
+
+
+class _MaxNorm[T](Protocol):
+    def maxNorm(self) -> T: ...
+
+
+class _LpNorm(Protocol):
+    def lpNorm(self, p: float, /) -> float: ...
+
+
+class _Any(Protocol):
+    def any(self) -> bool: ...
+
+
+class _All(Protocol):
+    def all(self) -> bool: ...
+
+
+def sum[T](vector: _Sum[T]) -> T:
+    """Returns the sum of all elements."""
+    return vector.sum()
+
+
+def product[T](vector: _Product[T]) -> T:
+    """Returns the product of all elements."""
+    return vector.product()
+
+
+def min[T](vector: _Min[T]) -> T:
+    """Returns the minimum of all elements (not defined for complex values)."""
+    return vector.min()
+
+
+def max[T](vector: _Max[T]) -> T:
+    """Returns the maximum of all elements (not defined for complex values)."""
+    return vector.max()
+
+
+def argMin[T](vector: _ArgMin[T]) -> tuple[T, int]:
+    """Returns a tuple `(value, index)` of the minimum and the index of its first occurrence."""
+    return vector.argMin()
+
+
+def argMax[T](vector: _ArgMax[T]) -> tuple[T, int]:
+    """Returns a tuple `(value, index)` of the maximum and the index of its first occurrence."""
+    return vector.argMax()
+
+
+def dot[T, U](a: _Dot[T, U], b: U) -> T:
+    """Returns the dot product `sum(a * b)` (complex values are not conjugated)."""
+    return a.dot(b)
+
+
+def l1Norm[T](vector: _L1Norm[T]) -> T:
+    """Returns the sum of absolute values of all elements."""
+    return vector.l1Norm()
+
+
+def l2Norm(vector: _L2Norm) -> float:
+    """Returns the Euclidean norm."""
+    return vector.l2Norm()
+
+
+def maxNorm[T](vector: _MaxNorm[T]) -> T:
+    """Returns the maximum of absolute values of all elements."""
+    return vector.maxNorm()
+
+
+def lpNorm(vector: _LpNorm, p: float) -> float:
+    """Returns the lp-norm `sum(abs(vector)**p)**(1/p)` for `p >= 1`."""
+    return vector.lpNorm(p)
+
+
+def any(vector: _Any) -> bool:
+    """Returns `True` if any element is non-zero."""
+    return vector.any()
+
+
+def all(vector: _All) -> bool:
+    """Returns `True` if all elements are non-zero."""
+    return vector.all()
+
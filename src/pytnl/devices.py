@@ -1,3 +1,9 @@
+import importlib
+import sys
+from collections.abc import Callable, Iterator
+from typing import ClassVar, cast
+
+
 class AbstractDevice:
     """
     A base class for all device types supported by PyTNL.
@@ -5,6 +11,18 @@ class AbstractDevice:
     """
 
 
+def _extension_functions(name: str) -> Iterator[Callable[..., object]]:
+    """
+    Yields the function `name` from all loaded PyTNL extension modules.
+
+    Each extension module has its own copy of the TNL settings for the host
+    device, so the settings must be applied to all of them.
+    """
+    for module_name, module in list(sys.modules.items()):
+        if module_name.startswith("pytnl.") and hasattr(module, name):
+            yield cast(Callable[..., object], getattr(module, name))
+
+
 class Host(AbstractDevice):
     """
     Class for the *host* device in TNL. It corresponds to the
@@ -14,6 +32,40 @@ class Host(AbstractDevice):
     algorithms compiled for the *host system*, i.e. CPU execution.
     """
 
+    # The value set by `setMaxThreadsCount` (`None` means the OpenMP default).
+    # Extension modules loaded later read it during their initialization.
+    _max_threads_count: ClassVar[int | None] = None
+
+    @classmethod
+    def setMaxThreadsCount(cls, count: int) -> None:
+        """
+        Sets the maximal number of OpenMP threads used by TNL algorithms on
+        the host in all PyTNL modules.
+        """
+        if count < 1:
+            raise ValueError(f"the maximal number of threads must be positive, got {count}")
+        cls._max_threads_count = count
+        for set_max_threads_count in _extension_functions("_Host_setMaxThreadsCount"):
+            set_max_threads_count(count)
+
+    @staticmethod
+    def getMaxThreadsCount() -> int:
+        """
+        Returns the maximal number of OpenMP threads used by TNL algorithms on
+        the host.
+        """
+        containers = importlib.import_module("pytnl._containers")
+        return cast(int, containers._Host_getMaxThreadsCount())
+
+    @staticmethod
+    def isOMPEnabled() -> bool:
+        """
+        Returns `True` if PyTNL was built with OpenMP and TNL algorithms on
+        the host run in parallel.
+        """
+        containers = importlib.import_module("pytnl._containers")
+        return cast(bool, containers._Host_isOMPEnabled())
+
 
 class Cuda(AbstractDevice):
     """
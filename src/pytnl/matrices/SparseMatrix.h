@@ -1,8 +1,17 @@
 #pragma once
 
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include <pytnl/pytnl.h>
+#include <pytnl/containers/copy_on_write.h>
+#include <pytnl/containers/pickle.h>
 
 #include <TNL/Containers/Vector.h>
+#include <TNL/Containers/VectorView.h>
+#include <TNL/Matrices/SparseOperations.h>
 #include <TNL/TypeTraits.h>
 
 template< typename RowView, typename Scope >
@@ -56,13 +65,18 @@ struct export_CSR< Segments, typename TNL::enable_if_type< decltype( Segments{}.
    static void
    e( Scope& s )
    {
+      // the view is indexed by ::IndexType so that it is one of the types
+      // registered in pytnl._containers even for segments with 32-bit indices
+      using OffsetsView =
+         TNL::Containers::VectorView< const typename Segments::IndexType, typename Segments::DeviceType, ::IndexType >;
       s.def(
          "getOffsets",
-         []( const Segments& segments ) -> typename Segments::ConstOffsetsView
+         []( const Segments& segments ) -> OffsetsView
          {
-            return segments.getOffsets();
+            const auto offsets = segments.getOffsets();
+            return OffsetsView( offsets.getData(), offsets.getSize() );
          },
-         nb::rv_policy::reference_internal );
+         nb::keep_alive< 0, 1 >() );
    }
 };
 
@@ -100,8 +114,11 @@ export_Matrix( nb::module_& m, const char* name )
    using IndexType = typename Matrix::IndexType;
    using ComputeRealType = typename Matrix::ComputeRealType;
 
-   using VectorType = TNL::Containers::Vector< RealType, DeviceType, IndexType >;
-   using IndexVectorType = TNL::Containers::Vector< IndexType, DeviceType, IndexType >;
+   // vectors passed from Python always use the global index type, matrices
+   // with 32-bit indices convert the row capacities and use the same vectors
+   // in vectorProduct
+   using VectorType = pytnl::Vector< RealType, DeviceType >;
+   using IndexVectorType = pytnl::Vector< ::IndexType, DeviceType >;
 
    auto matrix =
       nb::class_< Matrix >( m, name )
@@ -170,6 +187,7 @@ export_Matrix( nb::module_& m, const char* name )
                 IndexType begin = 0,
                 IndexType end = 0 ) -> void
             {
+               pytnl::containers::detach( outVector );
                matrix.vectorProduct( inVector, outVector, matrixMultiplicator, outVectorMultiplicator, begin, end );
             } )
          // TODO: these two don't work
@@ -183,10 +201,111 @@ export_Matrix( nb::module_& m, const char* name )
                return matrix = other;
             } )
 
-         // accessors for internal vectors
-         .def( "getValues", nb::overload_cast<>( &Matrix::getValues ), nb::rv_policy::reference_internal )
-         .def( "getColumnIndexes", nb::overload_cast<>( &Matrix::getColumnIndexes ), nb::rv_policy::reference_internal )
-         .def( "getSegments", nb::overload_cast<>( &Matrix::getSegments ), nb::rv_policy::reference_internal );
+         .def( "getSegments", nb::overload_cast<>( &Matrix::getSegments ), nb::rv_policy::reference_internal )
+
+         // Pickle support: the state consists of the dimensions, row capacities
+         // and the raw data of the column indexes and values (exposed as
+         // PickleBuffer with protocol 5), so the matrix is rebuilt by the same
+         // allocation and two copies
+         .def(
+            "__reduce_ex__",
+            []( nb::handle self, int protocol )
+            {
+               const Matrix& matrix = nb::cast< const Matrix& >( self );
+               IndexVectorType capacities;
+               matrix.getRowCapacities( capacities );
+               nb::object state = nb::make_tuple(
+                  matrix.getRows(),
+                  matrix.getColumns(),
+                  std::move( capacities ),
+                  pytnl::containers::pickle::pickle_view( matrix.getColumnIndexes().getConstView(), self, protocol ),
+                  pytnl::containers::pickle::pickle_view( matrix.getValues().getConstView(), self, protocol ) );
+               return nb::make_tuple( self.type(), nb::tuple(), state );
+            },
+            nb::arg( "protocol" ),
+            nb::sig( "def __reduce_ex__(self, protocol: typing.SupportsIndex, /) -> tuple[typing.Any, ...]" ) )
+         .def(
+            "__setstate__",
+            []( Matrix* self, const std::tuple< IndexType, IndexType, IndexVectorType, nb::handle, nb::handle >& state )
+            {
+               // `self` is not constructed yet, the matrix is built in a local first
+               Matrix matrix;
+               matrix.setDimensions( std::get< 0 >( state ), std::get< 1 >( state ) );
+               matrix.setRowCapacities( std::get< 2 >( state ) );
+               pytnl::containers::pickle::unpickle_view( matrix.getColumnIndexes().getView(), std::get< 3 >( state ) );
+               pytnl::containers::pickle::unpickle_view( matrix.getValues().getView(), std::get< 4 >( state ) );
+               new( self ) Matrix( std::move( matrix ) );
+            },
+            nb::arg( "state" ) );
+
+   // accessors for internal vectors
+   if constexpr( std::is_same_v< IndexType, ::IndexType > ) {
+      matrix.def( "getValues", nb::overload_cast<>( &Matrix::getValues ), nb::rv_policy::reference_internal )
+         .def( "getColumnIndexes", nb::overload_cast<>( &Matrix::getColumnIndexes ), nb::rv_policy::reference_internal );
+   }
+   else {
+      // the internal vectors of matrices with 32-bit indices are not
+      // registered types, so they are exposed as views indexed by ::IndexType
+      using ValuesView = TNL::Containers::VectorView< RealType, DeviceType, ::IndexType >;
+      using ColumnIndexesView = TNL::Containers::VectorView< IndexType, DeviceType, ::IndexType >;
+      matrix
+         .def(
+            "getValues",
+            []( Matrix& matrix )
+            {
+               auto& values = matrix.getValues();
+               return ValuesView( values.getData(), values.getSize() );
+            },
+            nb::keep_alive< 0, 1 >() )
+         .def(
+            "getColumnIndexes",
+            []( Matrix& matrix )
+            {
+               auto& columnIndexes = matrix.getColumnIndexes();
+               return ColumnIndexesView( columnIndexes.getData(), columnIndexes.getSize() );
+            },
+            nb::keep_alive< 0, 1 >() );
+   }
+
+   // the segments do not depend on the real type, so matrices with different
+   // real types share the same class
+   if( nb::type< typename Matrix::SegmentsType >().is_valid() )
+      matrix.attr( "Segments" ) = nb::type< typename Matrix::SegmentsType >();
+   else
+      export_Segments< typename Matrix::SegmentsType >( matrix, "Segments" );
+}
+
+/* Conversion of a sparse matrix to a matrix with a narrower index type (e.g.
+ * 32-bit column indices). The dimensions of the source and the storage size
+ * of the target are checked first, the index arithmetic of TNL would
+ * overflow silently. `WideTarget` is the format of the target with the index
+ * type of the source, its segments give the storage size for the row lengths
+ * which `copySparseMatrix` sets (Ellpack formats store `rows * rowLength`
+ * elements, which may exceed the index range even if the number of nonzero
+ * elements does not).
+ */
+template< typename Target, typename Source, typename WideTarget >
+void
+copySparseMatrix_narrowing( Target& target, const Source& source )
+{
+   static_assert( std::is_same_v< typename WideTarget::IndexType, typename Source::IndexType > );
+   constexpr auto max = std::numeric_limits< typename Target::IndexType >::max();
+   auto check = [ & ]( const char* what, typename Source::IndexType value )
+   {
+      if( value > max ) {
+         const std::string message = std::string( "the number of " ) + what + " (" + std::to_string( value )
+                                   + ") exceeds the maximum index of the target matrix (" + std::to_string( max ) + ")";
+         PyErr_SetString( PyExc_OverflowError, message.c_str() );
+         throw nb::python_error();
+      }
+   };
+   check( "rows", source.getRows() );
+   check( "columns", source.getColumns() );
 
-   export_Segments< typename Matrix::SegmentsType >( matrix, "Segments" );
+   pytnl::Vector< typename Source::IndexType, typename Source::DeviceType > rowLengths;
+   source.getCompressedRowLengths( rowLengths );
+   typename WideTarget::SegmentsType segments;
+   segments.setSegmentsSizes( rowLengths );
+   check( "stored elements", segments.getStorageSize() );
+   TNL::Matrices::copySparseMatrix( target, source );
 }
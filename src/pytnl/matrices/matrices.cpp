@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -16,10 +18,31 @@ using Ellpack = TNL::Algorithms::Segments::Ellpack< Device, Index, IndexAllocato
 template< typename Device, typename Index, typename IndexAllocator >
 using SlicedEllpack = TNL::Algorithms::Segments::SlicedEllpack< Device, Index, IndexAllocator >;
 
-using CSR_host = TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Host, IndexType, TNL::Matrices::GeneralMatrix, CSR >;
-using E_host = TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Host, IndexType, TNL::Matrices::GeneralMatrix, Ellpack >;
-using SE_host =
-   TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Host, IndexType, TNL::Matrices::GeneralMatrix, SlicedEllpack >;
+// the internal vectors use the same allocator as the vectors in pytnl._containers,
+// so that getValues, getColumnIndexes, etc. return the registered types
+template< typename Real, template< typename, typename, typename > class Segments, typename Index = IndexType >
+using SparseMatrix_host = TNL::Matrices::SparseMatrix< Real,
+                                                       TNL::Devices::Host,
+                                                       Index,
+                                                       TNL::Matrices::GeneralMatrix,
+                                                       Segments,
+                                                       Real,
+                                                       pytnl::Allocator< Real, TNL::Devices::Host >,
+                                                       pytnl::Allocator< Index, TNL::Devices::Host > >;
+
+using CSR_host = SparseMatrix_host< RealType, CSR >;
+using E_host = SparseMatrix_host< RealType, Ellpack >;
+using SE_host = SparseMatrix_host< RealType, SlicedEllpack >;
+
+using CSR_float32_host = SparseMatrix_host< Float32Type, CSR >;
+using E_float32_host = SparseMatrix_host< Float32Type, Ellpack >;
+using SE_float32_host = SparseMatrix_host< Float32Type, SlicedEllpack >;
+
+// 32-bit column indices halve the index traffic of SpMV for matrices with
+// less than 2^31 rows and columns
+using CSR_index32_host = SparseMatrix_host< RealType, CSR, Index32Type >;
+using E_index32_host = SparseMatrix_host< RealType, Ellpack, Index32Type >;
+using SE_index32_host = SparseMatrix_host< RealType, SlicedEllpack, Index32Type >;
 
 void
 export_SparseMatrices( nb::module_& m )
@@ -27,12 +50,22 @@ export_SparseMatrices( nb::module_& m )
    export_Matrix< CSR_host >( m, "CSR" );
    export_Matrix< E_host >( m, "Ellpack" );
    export_Matrix< SE_host >( m, "SlicedEllpack" );
+   export_Matrix< CSR_float32_host >( m, "CSR_float32" );
+   export_Matrix< E_float32_host >( m, "Ellpack_float32" );
+   export_Matrix< SE_float32_host >( m, "SlicedEllpack_float32" );
+   export_Matrix< CSR_index32_host >( m, "CSR_index32" );
+   export_Matrix< E_index32_host >( m, "Ellpack_index32" );
+   export_Matrix< SE_index32_host >( m, "SlicedEllpack_index32" );
 
    // NOTE: all exported formats (CSR, Ellpack, SlicedEllpack) use the same
    // SegmentView, so the RowView and ConstRowView are also the same types in all
    // three formats
    export_RowView< typename CSR_host::RowView >( m, "SparseMatrixRowView" );
    export_RowView< typename CSR_host::ConstRowView >( m, "SparseMatrixConstRowView" );
+   export_RowView< typename CSR_float32_host::RowView >( m, "SparseMatrixRowView_float32" );
+   export_RowView< typename CSR_float32_host::ConstRowView >( m, "SparseMatrixConstRowView_float32" );
+   export_RowView< typename CSR_index32_host::RowView >( m, "SparseMatrixRowView_index32" );
+   export_RowView< typename CSR_index32_host::ConstRowView >( m, "SparseMatrixConstRowView_index32" );
 
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_host, E_host > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_host, CSR_host > );
@@ -40,15 +73,33 @@ export_SparseMatrices( nb::module_& m )
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_host, CSR_host > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_host, SE_host > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_host, E_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_float32_host, E_float32_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_float32_host, CSR_float32_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_float32_host, SE_float32_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_float32_host, CSR_float32_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_float32_host, SE_float32_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_float32_host, E_float32_host > );
+
+   // conversions between 64-bit and 32-bit indices
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< CSR_index32_host, CSR_host, CSR_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_host, CSR_index32_host > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< E_index32_host, E_host, E_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_host, E_index32_host > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< SE_index32_host, SE_host, SE_host > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_host, SE_index32_host > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< E_index32_host, CSR_host, E_host > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< SE_index32_host, CSR_host, SE_host > );
 }
 
 // Python module definition
 NB_MODULE( matrices, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers" );
+   import_caching_pool();
 
    export_SparseMatrices( m );
 }
@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -21,18 +23,42 @@ using E_cuda = TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Cuda, IndexT
 using SE_cuda =
    TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Cuda, IndexType, TNL::Matrices::GeneralMatrix, SlicedEllpack >;
 
+using CSR_float32_cuda =
+   TNL::Matrices::SparseMatrix< Float32Type, TNL::Devices::Cuda, IndexType, TNL::Matrices::GeneralMatrix, CSR >;
+using E_float32_cuda =
+   TNL::Matrices::SparseMatrix< Float32Type, TNL::Devices::Cuda, IndexType, TNL::Matrices::GeneralMatrix, Ellpack >;
+using SE_float32_cuda =
+   TNL::Matrices::SparseMatrix< Float32Type, TNL::Devices::Cuda, IndexType, TNL::Matrices::GeneralMatrix, SlicedEllpack >;
+
+using CSR_index32_cuda =
+   TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Cuda, Index32Type, TNL::Matrices::GeneralMatrix, CSR >;
+using E_index32_cuda =
+   TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Cuda, Index32Type, TNL::Matrices::GeneralMatrix, Ellpack >;
+using SE_index32_cuda =
+   TNL::Matrices::SparseMatrix< RealType, TNL::Devices::Cuda, Index32Type, TNL::Matrices::GeneralMatrix, SlicedEllpack >;
+
 void
 export_SparseMatrices( nb::module_& m )
 {
    export_Matrix< CSR_cuda >( m, "CSR" );
    export_Matrix< E_cuda >( m, "Ellpack" );
    export_Matrix< SE_cuda >( m, "SlicedEllpack" );
+   export_Matrix< CSR_float32_cuda >( m, "CSR_float32" );
+   export_Matrix< E_float32_cuda >( m, "Ellpack_float32" );
+   export_Matrix< SE_float32_cuda >( m, "SlicedEllpack_float32" );
+   export_Matrix< CSR_index32_cuda >( m, "CSR_index32" );
+   export_Matrix< E_index32_cuda >( m, "Ellpack_index32" );
+   export_Matrix< SE_index32_cuda >( m, "SlicedEllpack_index32" );
 
    // NOTE: all exported formats (CSR, Ellpack, SlicedEllpack) use the same
    // SegmentView, so the RowView and ConstRowView are also the same types in all
    // three formats
    export_RowView< typename CSR_cuda::RowView >( m, "SparseMatrixRowView" );
    export_RowView< typename CSR_cuda::ConstRowView >( m, "SparseMatrixConstRowView" );
+   export_RowView< typename CSR_float32_cuda::RowView >( m, "SparseMatrixRowView_float32" );
+   export_RowView< typename CSR_float32_cuda::ConstRowView >( m, "SparseMatrixConstRowView_float32" );
+   export_RowView< typename CSR_index32_cuda::RowView >( m, "SparseMatrixRowView_index32" );
+   export_RowView< typename CSR_index32_cuda::ConstRowView >( m, "SparseMatrixConstRowView_index32" );
 
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_cuda, E_cuda > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_cuda, CSR_cuda > );
@@ -40,15 +66,33 @@ export_SparseMatrices( nb::module_& m )
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_cuda, CSR_cuda > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_cuda, SE_cuda > );
    m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_cuda, E_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_float32_cuda, E_float32_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_float32_cuda, CSR_float32_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_float32_cuda, SE_float32_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_float32_cuda, CSR_float32_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_float32_cuda, SE_float32_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_float32_cuda, E_float32_cuda > );
+
+   // conversions between 64-bit and 32-bit indices
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< CSR_index32_cuda, CSR_cuda, CSR_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< CSR_cuda, CSR_index32_cuda > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< E_index32_cuda, E_cuda, E_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< E_cuda, E_index32_cuda > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< SE_index32_cuda, SE_cuda, SE_cuda > );
+   m.def( "copySparseMatrix", &TNL::Matrices::copySparseMatrix< SE_cuda, SE_index32_cuda > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< E_index32_cuda, CSR_cuda, E_cuda > );
+   m.def( "copySparseMatrix", &copySparseMatrix_narrowing< SE_index32_cuda, CSR_cuda, SE_cuda > );
 }
 
 // Python module definition
 NB_MODULE( matrices_cuda, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers_cuda" );
+   import_caching_pool();
 
    export_SparseMatrices( m );
 }
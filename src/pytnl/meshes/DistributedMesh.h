@@ -6,6 +6,8 @@ template< typename Mesh >
 void
 export_DistributedMesh( nb::module_& m, const char* name )
 {
+   // the global index arrays use the TNL default allocator, which is not
+   // registered in pytnl._containers, so they are returned as const views
    auto mesh =  //
       nb::class_< Mesh >( m, name )
          .def( nb::init<>() )
@@ -17,18 +19,18 @@ export_DistributedMesh( nb::module_& m, const char* name )
          .def( "getGhostLevels", &Mesh::getGhostLevels )
          .def(
             "getGlobalPointIndices",
-            []( const Mesh& mesh ) -> typename Mesh::GlobalIndexArray const&
+            []( const Mesh& mesh ) -> typename Mesh::GlobalIndexArray::ConstViewType
             {
-               return mesh.template getGlobalIndices< 0 >();
+               return mesh.template getGlobalIndices< 0 >().getConstView();
             },
-            nb::rv_policy::reference_internal )
+            nb::keep_alive< 0, 1 >() )
          .def(
             "getGlobalCellIndices",
-            []( const Mesh& mesh ) -> typename Mesh::GlobalIndexArray const&
+            []( const Mesh& mesh ) -> typename Mesh::GlobalIndexArray::ConstViewType
             {
-               return mesh.template getGlobalIndices< Mesh::getMeshDimension() >();
+               return mesh.template getGlobalIndices< Mesh::getMeshDimension() >().getConstView();
             },
-            nb::rv_policy::reference_internal )
+            nb::keep_alive< 0, 1 >() )
          .def(
             "vtkPointGhostTypes",
             []( const Mesh& mesh ) -> typename Mesh::VTKTypesArrayType const&
@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -36,9 +38,11 @@ export_distributeSubentities( nb::module_& m );
 NB_MODULE( _meshes, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers" );
+   import_caching_pool();
 
    // MPI initialization and finalization
    // https://stackoverflow.com/q/64647846
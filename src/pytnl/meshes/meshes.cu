@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -26,9 +28,11 @@ export_resolveMeshType( nb::module_& m );
 NB_MODULE( _meshes_cuda, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers_cuda" );
+   import_caching_pool();
    nb::module_::import_( "pytnl._meshes" );
 
    // bindings for data structures
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pytnl/pytnl.h>
+#include <pytnl/containers/copy_on_write.h>
 
 #include <TNL/Solvers/ODE/ODESolver.h>
 
@@ -36,6 +37,7 @@ export_ODESolver( nb::module_& m, const char* name )
                 std::function< void( const Real& t, const Real& tau, const VectorView& u, VectorView& fu ) > f )
             // TODO: generalize for functions with any number of arguments
             {
+               pytnl::containers::detach( u );
                return self.solve( u, f );
             } )
          .def(
@@ -45,6 +47,7 @@ export_ODESolver( nb::module_& m, const char* name )
                 std::function< void( const Real& t, const Real& tau, const VectorView& u, VectorView& fu ) > f )
             // TODO: generalize for functions with any number of arguments
             {
+               pytnl::containers::detach( u );
                return self.iterate( u, f );
             } );
 }
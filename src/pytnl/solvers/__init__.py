@@ -281,6 +281,258 @@ class _ODESolverMeta(CPPClassTemplate):
         /,
     ) -> type[_solvers_cuda.ODESolver_VanDerHouwenWray]: ...  # pyright: ignore[reportUnknownMemberType]
 
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.BogackiShampin_float32] | tuple[type[ode_methods.BogackiShampin_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_BogackiShampin_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.BogackiShampin_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_BogackiShampin_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.CashKarp_float32] | tuple[type[ode_methods.CashKarp_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_CashKarp_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.CashKarp_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_CashKarp_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.DormandPrince_float32] | tuple[type[ode_methods.DormandPrince_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_DormandPrince_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.DormandPrince_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_DormandPrince_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Euler_float32] | tuple[type[ode_methods.Euler_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Euler_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Euler_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Euler_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Fehlberg2_float32] | tuple[type[ode_methods.Fehlberg2_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Fehlberg2_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Fehlberg2_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Fehlberg2_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Fehlberg5_float32] | tuple[type[ode_methods.Fehlberg5_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Fehlberg5_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Fehlberg5_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Fehlberg5_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Heun2_float32] | tuple[type[ode_methods.Heun2_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Heun2_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Heun2_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Heun2_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Heun3_float32] | tuple[type[ode_methods.Heun3_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Heun3_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Heun3_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Heun3_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Kutta_float32] | tuple[type[ode_methods.Kutta_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Kutta_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Kutta_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Kutta_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.KuttaMerson_float32] | tuple[type[ode_methods.KuttaMerson_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_KuttaMerson_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.KuttaMerson_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_KuttaMerson_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Midpoint_float32] | tuple[type[ode_methods.Midpoint_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Midpoint_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Midpoint_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Midpoint_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.OriginalRungeKutta_float32] | tuple[type[ode_methods.OriginalRungeKutta_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_OriginalRungeKutta_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.OriginalRungeKutta_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_OriginalRungeKutta_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Ralston2_float32] | tuple[type[ode_methods.Ralston2_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Ralston2_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Ralston2_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Ralston2_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Ralston3_float32] | tuple[type[ode_methods.Ralston3_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Ralston3_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Ralston3_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Ralston3_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Ralston4_float32] | tuple[type[ode_methods.Ralston4_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Ralston4_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Ralston4_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Ralston4_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.Rule38_float32] | tuple[type[ode_methods.Rule38_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_Rule38_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.Rule38_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_Rule38_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.SSPRK3_float32] | tuple[type[ode_methods.SSPRK3_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_SSPRK3_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.SSPRK3_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_SSPRK3_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
+    @overload
+    def __getitem__(
+        self,
+        key: type[ode_methods.VanDerHouwenWray_float32] | tuple[type[ode_methods.VanDerHouwenWray_float32], type[pytnl.devices.Host]],
+        /,
+    ) -> type[pytnl._solvers.ODESolver_VanDerHouwenWray_float32]: ...
+
+    @overload
+    def __getitem__(  # type: ignore[no-any-unimported, unused-ignore]
+        self,
+        key: tuple[type[ode_methods.VanDerHouwenWray_float32], type[pytnl.devices.Cuda]],
+        /,
+    ) -> type[_solvers_cuda.ODESolver_VanDerHouwenWray_float32]: ...  # pyright: ignore[reportUnknownMemberType]
+
     def __getitem__(self, key: type[Any] | tuple[type[Any], type[Any]], /) -> type[Any]:
         if isinstance(key, tuple):
             items = key
@@ -303,6 +555,7 @@ class ODESolver(metaclass=_ODESolverMeta):
     - `ODESolver[ode_methods.Euler]` → `_solvers.ODESolver_Euler`
     - `ODESolver[ode_methods.Euler, devices.Host]` → `_solvers.ODESolver_Euler`
     - `ODESolver[ode_methods.DormandPrince, devices.Cuda]` → `_solvers_cuda.ODESolver_DormandPrince`
+    - `ODESolver[ode_methods.Euler_float32]` → `_solvers.ODESolver_Euler_float32` (single precision)
     """
 
 
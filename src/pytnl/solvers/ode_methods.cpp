@@ -1,3 +1,5 @@
+#include <string>
+
 #include <pytnl/pytnl.h>
 
 #include <TNL/Solvers/ODE/Methods/BogackiShampin.h>
@@ -21,47 +23,56 @@
 
 template< typename Method, typename Scope >
 void
-export_ode_method( Scope& m, const char* name, const char* doc )
+export_ode_method( Scope& m, const std::string& name, const char* doc )
+{
+   nb::class_< Method >( m, name.c_str(), doc );
+}
+
+// methods for real types other than RealType have the type suffix in the name
+// (e.g. Euler_float32), so that they select the matching ODESolver class
+template< typename Real >
+void
+export_ode_methods_for( nb::module_& submodule, const std::string& suffix )
 {
-   nb::class_< Method >( m, name, doc );
+   export_ode_method< TNL::Solvers::ODE::Methods::BogackiShampin< Real > >(
+      submodule, "BogackiShampin" + suffix, "Third-order Bogacki-Shampin method with adaptive step (Matlab ode23)." );
+   export_ode_method< TNL::Solvers::ODE::Methods::CashKarp< Real > >(
+      submodule, "CashKarp" + suffix, "Fifth-order Cash-Karp method with adaptive step." );
+   export_ode_method< TNL::Solvers::ODE::Methods::DormandPrince< Real > >(
+      submodule, "DormandPrince" + suffix, "Fifth-order Dormand-Prince method (Matlab ode45)." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Euler< Real > >( submodule, "Euler" + suffix, "First-order Euler method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Fehlberg2< Real > >(
+      submodule, "Fehlberg2" + suffix, "Second-order Fehlberg method with adaptive step." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Fehlberg5< Real > >(
+      submodule, "Fehlberg5" + suffix, "Fifth-order Fehlberg method with adaptive step." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Heun2< Real > >(
+      submodule, "Heun2" + suffix, "Second-order Heun method with adaptive step." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Heun3< Real > >( submodule, "Heun3" + suffix, "Third-order Heun method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Kutta< Real > >( submodule, "Kutta" + suffix, "Third-order Kutta method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::KuttaMerson< Real > >(
+      submodule, "KuttaMerson" + suffix, "Fourth-order Runge-Kutta-Merson method with adaptive step." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Midpoint< Real > >(
+      submodule, "Midpoint" + suffix, "Second-order midpoint method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::OriginalRungeKutta< Real > >(
+      submodule, "OriginalRungeKutta" + suffix, "Classic fourth-order Runge-Kutta method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Ralston2< Real > >(
+      submodule, "Ralston2" + suffix, "Second-order Ralston method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Ralston3< Real > >(
+      submodule, "Ralston3" + suffix, "Third-order Ralston method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Ralston4< Real > >(
+      submodule, "Ralston4" + suffix, "Fourth-order Ralston method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::Rule38< Real > >(
+      submodule, "Rule38" + suffix, "Fourth-order 3/8-rule Runge-Kutta method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::SSPRK3< Real > >(
+      submodule, "SSPRK3" + suffix, "Third-order Strong Stability Preserving Runge-Kutta method." );
+   export_ode_method< TNL::Solvers::ODE::Methods::VanDerHouwenWray< Real > >(
+      submodule, "VanDerHouwenWray" + suffix, "Third-order Van der Houwen-Wray method." );
 }
 
 void
 export_ode_methods( nb::module_& m )
 {
    auto submodule = m.def_submodule( "ode_methods" );
-
-   export_ode_method< TNL::Solvers::ODE::Methods::BogackiShampin< RealType > >(
-      submodule, "BogackiShampin", "Third-order Bogacki-Shampin method with adaptive step (Matlab ode23)." );
-   export_ode_method< TNL::Solvers::ODE::Methods::CashKarp< RealType > >(
-      submodule, "CashKarp", "Fifth-order Cash-Karp method with adaptive step." );
-   export_ode_method< TNL::Solvers::ODE::Methods::DormandPrince< RealType > >(
-      submodule, "DormandPrince", "Fifth-order Dormand-Prince method (Matlab ode45)." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Euler< RealType > >( submodule, "Euler", "First-order Euler method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Fehlberg2< RealType > >(
-      submodule, "Fehlberg2", "Second-order Fehlberg method with adaptive step." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Fehlberg5< RealType > >(
-      submodule, "Fehlberg5", "Fifth-order Fehlberg method with adaptive step." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Heun2< RealType > >(
-      submodule, "Heun2", "Second-order Heun method with adaptive step." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Heun3< RealType > >( submodule, "Heun3", "Third-order Heun method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Kutta< RealType > >( submodule, "Kutta", "Third-order Kutta method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::KuttaMerson< RealType > >(
-      submodule, "KuttaMerson", "Fourth-order Runge-Kutta-Merson method with adaptive step." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Midpoint< RealType > >(
-      submodule, "Midpoint", "Second-order midpoint method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::OriginalRungeKutta< RealType > >(
-      submodule, "OriginalRungeKutta", "Classic fourth-order Runge-Kutta method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Ralston2< RealType > >(
-      submodule, "Ralston2", "Second-order Ralston method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Ralston3< RealType > >(
-      submodule, "Ralston3", "Third-order Ralston method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Ralston4< RealType > >(
-      submodule, "Ralston4", "Fourth-order Ralston method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::Rule38< RealType > >(
-      submodule, "Rule38", "Fourth-order 3/8-rule Runge-Kutta method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::SSPRK3< RealType > >(
-      submodule, "SSPRK3", "Third-order Strong Stability Preserving Runge-Kutta method." );
-   export_ode_method< TNL::Solvers::ODE::Methods::VanDerHouwenWray< RealType > >(
-      submodule, "VanDerHouwenWray", "Third-order Van der Houwen-Wray method." );
+   export_ode_methods_for< RealType >( submodule, "" );
+   export_ode_methods_for< Float32Type >( submodule, "_float32" );
 }
@@ -1,3 +1,5 @@
+#include <pytnl/caching_pool.h>
+#include <pytnl/devices.h>
 #include <pytnl/exceptions.h>
 #include <pytnl/pytnl.h>
 
@@ -24,8 +26,9 @@
 #include <TNL/Solvers/ODE/Methods/SSPRK3.h>
 #include <TNL/Solvers/ODE/Methods/VanDerHouwenWray.h>
 
-using Vector = TNL::Containers::Vector< RealType, TNL::Devices::Host, IndexType >;
+using Vector = pytnl::Vector< RealType, TNL::Devices::Host, IndexType >;
 using VectorView = typename Vector::ViewType;
+using Vector_float32 = pytnl::Vector< Float32Type, TNL::Devices::Host, IndexType >;
 using BogackiShampin = TNL::Solvers::ODE::Methods::BogackiShampin< RealType >;
 using CashKarp = TNL::Solvers::ODE::Methods::CashKarp< RealType >;
 using DormandPrince = TNL::Solvers::ODE::Methods::DormandPrince< RealType >;
@@ -45,6 +48,8 @@ using Rule38 = TNL::Solvers::ODE::Methods::Rule38< RealType >;
 using SSPRK3 = TNL::Solvers::ODE::Methods::SSPRK3< RealType >;
 using VanDerHouwenWray = TNL::Solvers::ODE::Methods::VanDerHouwenWray< RealType >;
 
+namespace Methods = TNL::Solvers::ODE::Methods;
+
 void
 export_ode_methods( nb::module_& m );
 
@@ -52,13 +57,17 @@ export_ode_methods( nb::module_& m );
 NB_MODULE( _solvers, m )
 {
    register_exceptions( m );
+   register_host_device( m );
 
    // import depending modules
    nb::module_::import_( "pytnl._containers" );
+   import_caching_pool();
 
    export_IterativeSolver< RealType, IndexType >( m, "IterativeSolver_float_int" );
+   export_IterativeSolver< Float32Type, IndexType >( m, "IterativeSolver_float32_int" );
 
    export_ExplicitSolver< RealType, IndexType >( m, "ExplicitSolver_float_int" );
+   export_ExplicitSolver< Float32Type, IndexType >( m, "ExplicitSolver_float32_int" );
 
    export_ode_methods( m );
 
@@ -80,4 +89,23 @@ NB_MODULE( _solvers, m )
    export_ODESolver< Rule38, Vector >( m, "ODESolver_Rule38" );
    export_ODESolver< SSPRK3, Vector >( m, "ODESolver_SSPRK3" );
    export_ODESolver< VanDerHouwenWray, Vector >( m, "ODESolver_VanDerHouwenWray" );
+
+   export_ODESolver< Methods::BogackiShampin< Float32Type >, Vector_float32 >( m, "ODESolver_BogackiShampin_float32" );
+   export_ODESolver< Methods::CashKarp< Float32Type >, Vector_float32 >( m, "ODESolver_CashKarp_float32" );
+   export_ODESolver< Methods::DormandPrince< Float32Type >, Vector_float32 >( m, "ODESolver_DormandPrince_float32" );
+   export_ODESolver< Methods::Euler< Float32Type >, Vector_float32 >( m, "ODESolver_Euler_float32" );
+   export_ODESolver< Methods::Fehlberg2< Float32Type >, Vector_float32 >( m, "ODESolver_Fehlberg2_float32" );
+   export_ODESolver< Methods::Fehlberg5< Float32Type >, Vector_float32 >( m, "ODESolver_Fehlberg5_float32" );
+   export_ODESolver< Methods::Heun2< Float32Type >, Vector_float32 >( m, "ODESolver_Heun2_float32" );
+   export_ODESolver< Methods::Heun3< Float32Type >, Vector_float32 >( m, "ODESolver_Heun3_float32" );
+   export_ODESolver< Methods::Kutta< Float32Type >, Vector_float32 >( m, "ODESolver_Kutta_float32" );
+   export_ODESolver< Methods::KuttaMerson< Float32Type >, Vector_float32 >( m, "ODESolver_KuttaMerson_float32" );
+   export_ODESolver< Methods::Midpoint< Float32Type >, Vector_float32 >( m, "ODESolver_Midpoint_float32" );
+   export_ODESolver< Methods::OriginalRungeKutta< Float32Type >, Vector_float32 >( m, "ODESolver_OriginalRungeKutta_float32" );
+   export_ODESolver< Methods::Ralston2< Float32Type >, Vector_float32 >( m, "ODESolver_Ralston2_float32" );
+   export_ODESolver< Methods::Ralston3< Float32Type >, Vector_float32 >( m, "ODESolver_Ralston3_float32" );
+   export_ODESolver< Methods::Ralston4< Float32Type >, Vector_float32 >( m, "ODESolver_Ralston4_float32" );
+   export_ODESolver< Methods::Rule38< Float32Type >, Vector_float32 >( m, "ODESolver_Rule38_float32" );
+   export_ODESolver< Methods::SSPRK3< Float32Type >, Vector_float32 >( m, "ODESolver_SSPRK3_float32" );
+   export_ODESolver< Methods::VanDerHouwenWray< Float32Type >, Vector_float32 >( m, "ODESolver_VanDerHouwenWray_float32" );
 }
@@ -1,7 +1,12 @@
+import array
+import bisect
 import copy
+import math
 import os
+import pickle
 import tempfile
 from collections.abc import Collection
+from pathlib import Path
 from typing import TypeVar
 
 import numpy as np
@@ -411,12 +416,122 @@ def test_slicing(array_type: type[A], data: st.DataObject, size: int, start: int
     for i in range(result.getSize()):
         assert result[i] == expected[i]
 
-    # TODO: slicing is not implemented for views yet
-    # view = array.getView()
-    # result_view = view[slice_]
-    # assert result_view.getSize() == len(expected)
-    # for i in range(result_view.getSize()):
-    #    assert result_view[i] == expected[i]
+    view = array.getView()
+    result_view = view[slice_]
+    assert result_view.getSize() == len(expected)
+    for i in range(result_view.getSize()):
+        assert result_view[i] == expected[i]
+
+    const_view = array.getConstView()
+    result_const_view = const_view[slice_]
+    assert list(result_const_view) == expected
+
+
+@pytest.mark.parametrize("array_type", array_types)
+@given(
+    data=st.data(),
+    size=st.integers(min_value=0, max_value=20),
+    start=st.integers(min_value=-25, max_value=25) | st.none(),
+    stop=st.integers(min_value=-25, max_value=25) | st.none(),
+    step=st.integers(min_value=-5, max_value=5).filter(lambda x: x != 0) | st.none(),
+)
+def test_slicing_negative(array_type: type[A], data: st.DataObject, size: int, start: int | None, stop: int | None, step: int | None) -> None:
+    elements = data.draw(st.lists(element_strategy(array_type), min_size=size, max_size=size))
+    array = create_array(elements, array_type)
+    slice_ = slice(start, stop, step)
+    result = array[slice_]
+    assert len(result) == len(elements[slice_])
+    assert list(result) == elements[slice_]
+    # slices of slices
+    assert list(result[::-1]) == elements[slice_][::-1]
+
+
+@pytest.mark.parametrize("array_type", array_types)
+def test_slices_are_views(array_type: type[A]) -> None:
+    array = array_type(10, 0)
+    contiguous = array[2:5]
+    assert isinstance(contiguous, array_type.ViewType)
+    strided = array[1::3]
+    assert isinstance(strided, getattr(pytnl._containers, f"StridedArrayView_{array_type.ValueType.__name__}"))
+    assert strided.getStride() == 3
+
+    contiguous[0] = 1
+    strided[1] = 2
+    assert list(array) == [0, 0, 1, 0, 2, 0, 0, 0, 0, 0]
+
+    contiguous.setValue(3)
+    strided.setValue(4)
+    assert list(array) == [0, 4, 3, 3, 4, 0, 0, 4, 0, 0]
+
+    # the sliced array is kept alive by the slice
+    del array
+    assert list(strided.copy()) == [4, 4, 4]
+
+
+@pytest.mark.parametrize("array_type", array_types)
+def test_slice_assignment(array_type: type[A]) -> None:
+    array = array_type(10, 0)
+    # contiguous slice from an array
+    array[0:3] = array_type(3, 1)
+    # strided slice from an array
+    array[3::3] = array_type(3, 2)
+    # contiguous slice from a strided view
+    array[7:] = array[0:6:2]
+    # strided slice from a strided view
+    array[::-5] = array[3:5]
+    # scalar fill
+    array[4:6] = 5
+    assert list(array) == [1, 1, 1, 2, 5, 5, 2, 1, 1, 2]
+
+    with pytest.raises(ValueError):
+        array[0:3] = array_type(2, 1)
+    with pytest.raises(TypeError):
+        array.getConstView()[0:3] = array_type(3, 1)
+
+
+@pytest.mark.parametrize("array_type", array_types)
+def test_overlapping_slice_assignment(array_type: type[A]) -> None:
+    def create(size: int) -> A:
+        array = array_type(size, 0)
+        for i in range(size):
+            array[i] = i
+        return array
+
+    # the source is read completely before the target is written, like with Python lists
+    n = 1000
+    expected = list(range(n))
+    array = create(n)
+    array[1:] = array[:-1]
+    expected[1:] = expected[:-1]
+    assert list(array) == expected
+
+    array = create(n)
+    array[::-1] = array
+    assert list(array) == list(range(n))[::-1]
+
+    array = create(3)
+    array[::2] = array[1::1]
+    assert list(array) == [1, 1, 2]
+
+    expected = list(range(n))
+    array = create(n)
+    array[::2] = array[n // 2 :]
+    expected[::2] = expected[n // 2 :]
+    assert list(array) == expected
+
+
+@pytest.mark.parametrize("array_type", array_types)
+def test_strided_buffer(array_type: type[A]) -> None:
+    array = array_type(10, 0)
+    for i in range(10):
+        array[i] = i
+    strided = array[8::-3]
+    np_view = np.asarray(strided)
+    assert np_view.strides == (-3 * np_view.itemsize,)
+    assert np_view.tolist() == [8, 5, 2]
+    np_view[0] = 42
+    assert array[8] == 42
+    assert not np.asarray(array.getConstView()[::2]).flags.writeable
 
 
 # ----------------------
@@ -696,3 +811,659 @@ def test_dlpack(array_type: type[A], data: st.DataObject) -> None:
     assert const_view_np.shape == dims, f"Expected shape {dims}, got {const_view_np.shape}"
     assert const_view_np.dtype == array_np.dtype
     assert np.all(const_view_np == list(array)), "Data mismatch in NumPy array from const view"
+
+
+# ----------------------
+# Scans
+# ----------------------
+
+
+def inclusive_scan(values: list[int], begin: int, end: int) -> list[int]:
+    result = list(values)
+    for i in range(begin + 1, end):
+        result[i] += result[i - 1]
+    return result
+
+
+@pytest.mark.parametrize("array_type", [pytnl._containers.Array_int, pytnl._containers.Vector_int])
+@given(data=st.data())
+def test_scan(array_type: type[A], data: st.DataObject) -> None:
+    values = data.draw(st.lists(st.integers(min_value=-1000, max_value=1000), max_size=20))
+    begin = data.draw(st.integers(min_value=0, max_value=len(values)))
+    end = data.draw(st.integers(min_value=begin, max_value=len(values)))
+    if end == 0:
+        end = len(values)
+    expected = inclusive_scan(values, begin, end)
+
+    a = create_array(values, array_type)
+    a.inplaceInclusiveScan(begin, end)
+    assert list(a) == expected
+
+    a = create_array(values, array_type)
+    a.getView().inplaceExclusiveScan(begin, end)
+    assert list(a) == values[:begin] + [0] * (begin < end) + expected[begin : end - 1] + values[end:]
+
+
+def test_scan_operations() -> None:
+    ScanOperation = pytnl.containers.ScanOperation
+    a = create_array([3.0, 1.0, 4.0, 1.0, 5.0], pytnl._containers.Array_float)
+    a.inplaceInclusiveScan(operation=ScanOperation.MAX)
+    assert list(a) == [3.0, 3.0, 4.0, 4.0, 5.0]
+    a.inplaceExclusiveScan(operation=ScanOperation.MIN)
+    # the identity of MIN is the largest representable value
+    assert a[0] >= 1e308
+    assert list(a)[1:] == [3.0, 3.0, 3.0, 3.0]
+
+    flags = pytnl.containers.Array[bool](4, False)
+    flags[2] = True
+    flags.inplaceInclusiveScan(operation=ScanOperation.LOGICAL_OR)
+    assert list(flags) == [False, False, True, True]
+
+    with pytest.raises(ValueError):
+        flags.inplaceInclusiveScan()
+    with pytest.raises(ValueError):
+        pytnl.containers.Array[complex](4).inplaceInclusiveScan(operation=ScanOperation.MAX)
+    with pytest.raises(ValueError):
+        a.inplaceInclusiveScan(operation=ScanOperation.LOGICAL_OR)
+    with pytest.raises(IndexError):
+        a.inplaceInclusiveScan(3, 2)
+    assert not hasattr(a.getConstView(), "inplaceInclusiveScan")
+
+
+@pytest.mark.parametrize("size", [10, 100_000])
+def test_segmented_scan(size: int) -> None:
+    # large sizes are split into several chunks when OpenMP is enabled
+    values = [(7 * i) % 5 for i in range(size)]
+    segment_starts = {0, 3, size // 3, size // 3 + 1, size - 1}
+    flags = pytnl.containers.Array[bool](size, False)
+    for i in segment_starts:
+        flags[i] = True
+
+    expected_inclusive = list(values)
+    expected_exclusive = [0] * size
+    for i in range(1, size):
+        if i not in segment_starts:
+            expected_inclusive[i] += expected_inclusive[i - 1]
+            expected_exclusive[i] = expected_inclusive[i - 1]
+
+    a = create_array(values, pytnl._containers.Vector_int)
+    a.inplaceInclusiveSegmentedScan(flags)
+    assert list(a) == expected_inclusive
+
+    a = create_array(values, pytnl._containers.Array_int)
+    a.getView().inplaceExclusiveSegmentedScan(flags.getConstView())
+    assert list(a) == expected_exclusive
+
+    with pytest.raises(ValueError):
+        a.inplaceInclusiveSegmentedScan(pytnl.containers.Array[bool](size + 1))
+
+
+# ----------------------
+# Sorting
+# ----------------------
+
+
+@pytest.mark.parametrize("array_type", [pytnl._containers.Array_int, pytnl._containers.Array_float, pytnl._containers.Vector_float])
+@pytest.mark.parametrize("size", [20, 100_000])
+def test_sort(array_type: type[A], size: int) -> None:
+    # large sizes are split into several chunks when OpenMP is enabled
+    values = [(7919 * i) % 1009 for i in range(size)]
+
+    a = create_array(values, array_type)
+    a.ascendingSort()
+    assert list(a) == sorted(values)
+
+    a = create_array(values, array_type)
+    a.getView().descendingSort()
+    assert list(a) == sorted(values, reverse=True)
+
+    a = create_array(values, array_type)
+    permutation = a.getConstView().argsort()
+    assert isinstance(permutation, pytnl._containers.Vector_int)
+    # the host sort is stable
+    assert list(permutation) == sorted(range(size), key=lambda i: values[i])
+    permutation = a.argsort(descending=True)
+    assert list(permutation) == sorted(range(size), key=lambda i: -values[i])
+
+
+@pytest.mark.parametrize("array_type", [pytnl._containers.Array_float, pytnl._containers.Vector_float])
+def test_sort_nan(array_type: type[A]) -> None:
+    nan = math.nan
+    values = [nan, 1.0, nan, 0.0, -math.inf, 2.0]
+
+    # NaNs are placed last in both orders
+    a = create_array(values, array_type)
+    a.ascendingSort()
+    assert list(a)[:4] == [-math.inf, 0.0, 1.0, 2.0]
+    assert all(math.isnan(x) for x in list(a)[4:])
+
+    a = create_array(values, array_type)
+    a.descendingSort()
+    assert list(a)[:4] == [2.0, 1.0, 0.0, -math.inf]
+    assert all(math.isnan(x) for x in list(a)[4:])
+
+    a = create_array(values, array_type)
+    assert list(a.argsort()) == [4, 3, 1, 5, 0, 2]
+    assert list(a.argsort(descending=True)) == [5, 1, 3, 4, 0, 2]
+
+    keys = create_array(values, array_type)
+    b = create_array(list(range(len(values))), pytnl._containers.Array_int)
+    b.sortByKey(keys)
+    assert list(b) == [4, 3, 1, 5, 0, 2]
+
+    a = create_array([0.0, 1.0, nan, nan], array_type)
+    q = create_array([nan, 0.5, 2.0], array_type)
+    assert list(a.searchsorted(q)) == [2, 1, 2]
+    assert list(a.searchsorted(q, side="right")) == [4, 1, 2]
+    assert a.searchsorted(nan) == 2
+    assert a.searchsorted(nan, side="right") == 4
+
+
+def test_sort_by_key() -> None:
+    keys = create_array([3, 1, 2, 1], pytnl._containers.Array_int)
+    values = create_array([1 + 0j, 2 + 0j, 3 + 0j, 4 + 0j], pytnl._containers.Array_complex)
+    values.sortByKey(keys)
+    assert list(keys) == [1, 1, 2, 3]
+    assert list(values) == [2, 4, 3, 1]
+
+    float_keys = create_array([0.5, 0.25, 0.75, 0.0], pytnl._containers.Vector_float)
+    values.getView().sortByKey(float_keys, descending=True)
+    assert list(float_keys) == [0.75, 0.5, 0.25, 0.0]
+    assert list(values) == [3, 2, 4, 1]
+
+    with pytest.raises(ValueError):
+        values.sortByKey(pytnl._containers.Array_int(3))
+
+    # single precision and 32-bit integer keys
+    int32_keys = pytnl._containers.Array_int32([2, 0, 1])
+    float32_keys = pytnl._containers.Array_float32([0.5, 1.5, -1.0])
+    values = create_array([1 + 0j, 2 + 0j, 3 + 0j], pytnl._containers.Array_complex)
+    values.sortByKey(int32_keys)
+    assert list(int32_keys) == [0, 1, 2]
+    assert list(values) == [2, 3, 1]
+    values.sortByKey(float32_keys)
+    assert list(float32_keys) == [-1.0, 0.5, 1.5]
+    assert list(values) == [1, 2, 3]
+
+    # keys sharing the data with the array
+    a = create_array([3, 1, 2, 1], pytnl._containers.Array_int)
+    a.sortByKey(a)
+    assert list(a) == [1, 1, 2, 3]
+    a.sortByKey(a.getView(), descending=True)
+    assert list(a) == [3, 2, 1, 1]
+    with pytest.raises(ValueError):
+        a[1:].sortByKey(a[:3])
+    assert list(a) == [3, 2, 1, 1]
+
+    assert not hasattr(values, "ascendingSort")
+    assert not hasattr(keys.getConstView(), "ascendingSort")
+
+
+@given(data=st.data())
+def test_searchsorted(data: st.DataObject) -> None:
+    sorted_values = sorted(data.draw(st.lists(st.integers(min_value=-100, max_value=100), max_size=20)))
+    queries = data.draw(st.lists(st.integers(min_value=-110, max_value=110), max_size=20))
+    a = create_array(sorted_values, pytnl._containers.Vector_int)
+    q = create_array(queries, pytnl._containers.Array_int)
+
+    assert list(a.searchsorted(q)) == [bisect.bisect_left(sorted_values, x) for x in queries]
+    assert list(a.searchsorted(q, side="right")) == [bisect.bisect_right(sorted_values, x) for x in queries]
+    for x in queries:
+        assert a.searchsorted(x) == bisect.bisect_left(sorted_values, x)
+        assert a.getConstView().searchsorted(x, side="right") == bisect.bisect_right(sorted_values, x)
+    with pytest.raises(ValueError):
+        a.searchsorted(q, side="middle")
+
+
+# ----------------------
+# Bulk conversion
+# ----------------------
+
+
+@pytest.mark.parametrize("array_type", array_types)
+@given(data=st.data())
+def test_bulk_constructor_and_tolist(array_type: type[A], data: st.DataObject) -> None:
+    elements = data.draw(st.lists(element_strategy(array_type), max_size=20))
+    for source in (elements, tuple(elements)):
+        a = array_type(source)
+        assert a.getSize() == len(elements)
+        assert list(a) == elements
+        assert a.tolist() == elements
+        assert a.getConstView().tolist() == elements
+
+
+def test_bulk_constructor_from_buffers() -> None:
+    Array = pytnl.containers.Array
+    Vector = pytnl.containers.Vector
+
+    # array.array of various item types
+    assert Array[int](array.array("i", [1, -2, 3])).tolist() == [1, -2, 3]
+    assert Array[int](array.array("B", [1, 2, 255])).tolist() == [1, 2, 255]
+    assert Vector[float](array.array("q", [1, 2, 3])).tolist() == [1.0, 2.0, 3.0]
+    assert Vector[float](array.array("f", [0.5, 1.5])).tolist() == [0.5, 1.5]
+    assert Vector[complex](array.array("d", [0.5, 1.5])).tolist() == [0.5, 1.5]
+    assert Array[int](b"\x01\x02").tolist() == [1, 2]
+
+    # NumPy arrays, including non-contiguous and boolean ones
+    x = np.arange(10, dtype=np.float64)
+    assert Vector[float](x).tolist() == x.tolist()
+    assert Vector[float](x[::-3]).tolist() == x[::-3].tolist()
+    assert Array[bool](np.array([True, False])).tolist() == [True, False]
+    assert Array[complex](np.array([1 + 2j], dtype=np.complex64)).tolist() == [1 + 2j]
+
+    # a vector from another array (through the buffer protocol)
+    assert Vector[float](Array[float]([1.0, 2.0])).tolist() == [1.0, 2.0]
+
+    # the size constructors take precedence
+    assert Array[int](3).getSize() == 3
+    assert Array[int](np.int64(3)).getSize() == 3
+    assert Vector[float](np.int32(2), 1.5).tolist() == [1.5, 1.5]
+    assert Array[int](3, 7).tolist() == [7, 7, 7]
+
+
+def test_bulk_constructor_errors() -> None:
+    Array = pytnl.containers.Array
+    with pytest.raises(TypeError):
+        Array[int](array.array("d", [1.5]))
+    with pytest.raises(TypeError):
+        Array[bool](array.array("i", [1]))
+    with pytest.raises(TypeError):
+        Array[float](np.array([1 + 1j]))
+    with pytest.raises(ValueError):
+        Array[float](np.zeros((2, 2)))
+    with pytest.raises(TypeError):
+        Array[float]("abc")  # type: ignore[arg-type]
+    with pytest.raises(TypeError):
+        Array[float]([1.0, "x"])
+
+    # values out of the range of the value type
+    with pytest.raises(OverflowError):
+        Array[int](np.array([2**63], dtype=np.uint64))
+    with pytest.raises(OverflowError):
+        pytnl._containers.Array_int32(np.array([2**40], dtype=np.int64))
+    with pytest.raises(OverflowError):
+        pytnl._containers.Array_float16(np.array([1e5], dtype=np.float64))
+    # infinities and rounding are not errors
+    assert pytnl._containers.Array_float16(np.array([np.inf, 0.1])).tolist() == [np.inf, float(np.float16(0.1))]
+    assert Array[float](np.array([2**53 + 1], dtype=np.int64)).tolist() == [2.0**53]
+
+
+def test_external_views() -> None:
+    VectorView = pytnl.containers.VectorView
+    ArrayView = pytnl.containers.ArrayView
+
+    # the view shares memory with the NumPy array
+    x = np.arange(10, dtype=np.float64)
+    v = VectorView[float](x)
+    assert v.getSize() == 10
+    assert v.tolist() == x.tolist()
+    x[0] = 42
+    assert v[0] == 42
+    v[1] = -1
+    assert x[1] == -1
+    v *= 2
+    assert x[2] == 4
+
+    # the view keeps the exporter alive
+    v = VectorView[int](np.arange(5, dtype=np.int64))
+    assert v.tolist() == [0, 1, 2, 3, 4]
+    assert ArrayView[bool](np.array([True, False])).tolist() == [True, False]
+    assert VectorView[complex](np.array([1 + 2j])).tolist() == [1 + 2j]
+
+    # read-only arrays can be wrapped only by constant views
+    y = np.arange(3, dtype=np.float64)
+    y.flags.writeable = False  # spellchecker:disable-line
+    with pytest.raises(TypeError):
+        VectorView[float](y)
+    c = pytnl._containers.VectorView_float_const(y)
+    assert c.tolist() == [0, 1, 2]
+
+    # no implicit copies: dtype, dimension and contiguity must match
+    with pytest.raises(TypeError):
+        VectorView[float](np.arange(3, dtype=np.float32))
+    with pytest.raises(TypeError):
+        VectorView[float](np.zeros((2, 2)))
+    with pytest.raises(TypeError):
+        VectorView[float](x[::2])
+    with pytest.raises(TypeError):
+        VectorView[int](np.arange(3, dtype=np.int32))
+
+
+def test_from_dlpack() -> None:
+    x = np.arange(6, dtype=np.float64)
+    v = pytnl.containers.from_dlpack(x)
+    assert isinstance(v, pytnl._containers.VectorView_float)
+    x[0] = 7
+    assert v[0] == 7
+
+    assert isinstance(pytnl.containers.from_dlpack(np.zeros(2, dtype=bool)), pytnl._containers.ArrayView_bool)
+    assert isinstance(pytnl.containers.from_dlpack(x, readonly=True), pytnl._containers.VectorView_float_const)
+
+    m = pytnl.containers.from_dlpack(x.reshape(2, 3))
+    assert isinstance(m, pytnl._containers.NDArrayView_2_float)
+    assert m[1, 2] == 5
+
+    y = np.arange(3, dtype=np.int64)
+    y.flags.writeable = False  # spellchecker:disable-line
+    assert isinstance(pytnl.containers.from_dlpack(y), pytnl._containers.VectorView_int_const)
+
+    # single, half precision and 32-bit integers have their own view classes
+    f = np.arange(6, dtype=np.float32)
+    assert isinstance(pytnl.containers.from_dlpack(f), pytnl._containers.VectorView_float32)
+    assert isinstance(pytnl.containers.from_dlpack(f.reshape(3, 2)), pytnl._containers.NDArrayView_2_float32)
+    assert isinstance(pytnl.containers.from_dlpack(f.astype(np.float16)), pytnl._containers.VectorView_float16)
+    i = pytnl.containers.from_dlpack(np.arange(3, dtype=np.int32), readonly=True)
+    assert isinstance(i, pytnl._containers.VectorView_int32_const)
+    assert list(i) == [0, 1, 2]
+
+    with pytest.raises(TypeError):
+        pytnl.containers.from_dlpack(np.zeros(3, dtype=np.uint16))
+    with pytest.raises(TypeError):
+        pytnl.containers.from_dlpack(np.zeros((2, 2), dtype=np.int32))
+    with pytest.raises(TypeError):
+        pytnl.containers.from_dlpack(x[::2])
+
+
+def _tnl_data_offset(filename: str) -> int:
+    # magic number, length of the serialization type, serialization type, size
+    with open(filename, "rb") as f:
+        header = f.read(9)
+    return 5 + 4 + int.from_bytes(header[5:9], "little") + 8
+
+
+MAPPED_PARAMS = [
+    (pytnl._containers.Array_bool, pytnl._containers.ArrayView_bool, pytnl._containers.ArrayView_bool_const),
+    (pytnl._containers.Array_int, pytnl._containers.ArrayView_int, pytnl._containers.ArrayView_int_const),
+    (pytnl._containers.Array_float, pytnl._containers.ArrayView_float, pytnl._containers.ArrayView_float_const),
+    (pytnl._containers.Array_complex, pytnl._containers.ArrayView_complex, pytnl._containers.ArrayView_complex_const),
+]
+
+
+@pytest.mark.parametrize("array_type, view_type, const_view_type", MAPPED_PARAMS)
+def test_load_mapped(
+    array_type: type[A],
+    view_type: type[pytnl._containers.ArrayView_float],
+    const_view_type: type[pytnl._containers.ArrayView_float_const],
+    tmp_path: Path,
+) -> None:
+    filename = str(tmp_path / "array.tnl")
+    a = array_type([i % 2 for i in range(100)])
+    a.save(filename, aligned=True)
+
+    # the aligned file is read by `load` like a TNL file
+    b = array_type()
+    b.load(filename)
+    assert b.tolist() == a.tolist()
+
+    # copy-on-write mapping (default)
+    v = view_type.loadMapped(filename)
+    assert v.tolist() == a.tolist()
+    v[0] = 1
+    b.load(filename)
+    assert b.tolist() == a.tolist()
+
+    # shared mapping: writes go to the file
+    v = view_type.loadMapped(filename, mode="r+")
+    v[0] = 1
+    del v
+    b.load(filename)
+    assert b[0] == 1
+
+    # read-only mapping
+    c = const_view_type.loadMapped(filename)
+    assert c.tolist() == b.tolist()
+    with pytest.raises(ValueError):
+        view_type.loadMapped(filename, mode="r")
+    with pytest.raises(ValueError):
+        const_view_type.loadMapped(filename, mode="c")
+
+
+def test_load_mapped_float64(tmp_path: Path) -> None:
+    filename = str(tmp_path / "vector.tnl")
+    a = pytnl.containers.Vector[float](np.linspace(0, 1, 10007))
+    a.save(filename, aligned=True)
+
+    # the data are aligned in the file and mapped in place
+    with open(filename, "rb") as f:
+        header = f.read(8)
+    assert header == b"PYTNLA01"
+    assert (os.path.getsize(filename) - 8 * 10007) % 64 == 0
+    v = pytnl.containers.VectorView[float].loadMapped(filename)
+    assert isinstance(v, pytnl._containers.VectorView_float)
+    assert v.tolist() == a.tolist()
+    assert np.array_equal(np.from_dlpack(v), np.from_dlpack(a))
+
+
+def test_load_mapped_tnl_format(tmp_path: Path) -> None:
+    filename = str(tmp_path / "array.tnl")
+    a = pytnl._containers.Array_float([0.5, 1.5, 2.5])
+    a.save(filename)
+    if _tnl_data_offset(filename) % 8 == 0:
+        assert pytnl._containers.ArrayView_float_const.loadMapped(filename).tolist() == a.tolist()
+    else:
+        # TNL files have no padding, so the data may be misaligned for in-place mapping
+        with pytest.raises(ValueError, match="aligned"):
+            pytnl._containers.ArrayView_float_const.loadMapped(filename)
+
+    # bytes are always aligned
+    b = pytnl._containers.Array_bool([True, False, True])
+    b.save(filename)
+    assert pytnl._containers.ArrayView_bool_const.loadMapped(filename).tolist() == b.tolist()
+
+
+def test_map_file(tmp_path: Path) -> None:
+    VectorView = pytnl.containers.VectorView
+    filename = str(tmp_path / "raw.bin")
+
+    # create a new (sparse) file
+    v = VectorView[float].mapFile(filename, 1000, mode="w+")
+    assert v.getSize() == 1000
+    assert os.path.getsize(filename) == 8000
+    v.setValue(2.0)
+    v[999] = 3.0
+    del v
+
+    # the raw data can be read by NumPy and mapped again
+    x = np.fromfile(filename, dtype=np.float64)
+    assert x[0] == 2.0 and x[999] == 3.0
+    w = VectorView[float].mapFile(filename)
+    assert w.getSize() == 1000
+    assert w.sum() == 2.0 * 999 + 3.0
+
+    # mapping with an offset
+    u = VectorView[float].mapFile(filename, 10, offset=8 * 990, mode="c")
+    assert u.tolist() == [2.0] * 9 + [3.0]
+
+    with pytest.raises(ValueError):
+        VectorView[float].mapFile(filename, 2000)
+    with pytest.raises(ValueError):
+        VectorView[float].mapFile(filename, offset=4)
+    with pytest.raises(ValueError):
+        VectorView[float].mapFile(filename, mode="x")
+    with pytest.raises(OSError):
+        VectorView[float].mapFile(str(tmp_path / "missing.bin"))
+
+
+def test_shared_memory() -> None:
+    VectorView = pytnl.containers.VectorView
+    name = f"pytnl-test-{os.getpid()}"
+
+    # the elements are zero-initialized
+    v = VectorView[float].createShared(name, 1000)
+    assert v.getSize() == 1000
+    assert v.sum() == 0
+    with pytest.raises(FileExistsError):
+        VectorView[float].createShared(name, 10)
+
+    # another mapping of the same memory (e.g. in another process)
+    w = VectorView[float].attachShared(name)
+    assert w.getSize() == 1000
+    v[10] = 3.0
+    assert w[10] == 3.0
+    c = pytnl._containers.ArrayView_float_const.attachShared(name)
+    assert c[10] == 3.0
+    with pytest.raises(ValueError):
+        VectorView[int].attachShared(name)
+
+    # the object is removed with the last mapping
+    del v, w, c
+    with pytest.raises(FileNotFoundError):
+        VectorView[float].attachShared(name)
+    with pytest.raises(FileNotFoundError):
+        VectorView[float].unlinkShared(name)
+    with pytest.raises(ValueError):
+        VectorView[float].createShared("a/b", 10)
+
+
+@pytest.mark.parametrize("array_type", array_types)
+@given(data=st.data())
+def test_append(array_type: type[A], data: st.DataObject) -> None:
+    elements = data.draw(st.lists(element_strategy(array_type), max_size=50))
+    a = array_type()
+    for i, value in enumerate(elements):
+        a.append(value)
+        assert a.getSize() == i + 1
+        # the capacity grows geometrically
+        assert i + 1 <= a.capacity() <= 2 * (i + 1)
+    assert list(a) == elements
+
+    b = array_type()
+    b.extend(a)
+    b.extend(elements)
+    b.extend(b)
+    assert list(b) == 4 * elements
+
+
+def test_reserve() -> None:
+    a = pytnl._containers.Vector_float()
+    a.reserve(100)
+    assert a.getSize() == 0
+    assert a.capacity() == 100
+    view = a.getView()
+    for i in range(100):
+        a.append(i)
+    # no reallocation within the reserved capacity
+    assert a.capacity() == 100
+    assert a.getView().getSize() == 100
+    assert view.getSize() == 0
+    a.append(100)
+    assert a.capacity() == 200
+    assert list(a) == list(range(101))
+    with pytest.raises(ValueError):
+        a.reserve(-1)
+
+    # buffers are converted like in the bulk constructor
+    a.extend(np.arange(3, dtype=np.int32))
+    a.extend(array.array("d", [5.0]))
+    assert list(a)[-4:] == [0, 1, 2, 5]
+    with pytest.raises(TypeError):
+        a.extend("abc")
+
+    # other array operations work with the reserved capacity
+    assert a.sum() == sum(range(101)) + 8
+    c = copy.copy(a)
+    c.append(1)
+    assert c.getSize() == a.getSize() + 1
+    a.resize(10)
+    assert a.capacity() == 10
+
+
+@pytest.mark.parametrize("array_type", array_types)
+def test_compressed_serialization(array_type: type[A], tmp_path: Path) -> None:
+    filename = str(tmp_path / "array.tnlz")
+    a = array_type([i % 7 for i in range(10000)])
+    a.saveCompressed(filename, chunkSize=1000, level=6)
+    assert os.path.getsize(filename) < 10000 * 8
+
+    b = array_type()
+    b.loadCompressed(filename)
+    assert b == a
+
+    # partial reads (within a chunk, across chunks, up to the end)
+    for begin, end in [(10, 20), (990, 2010), (9500, 0), (0, 1000)]:
+        b.loadCompressed(filename, begin, end)
+        assert b.tolist() == a.tolist()[begin : end or None]
+
+    # a view can be saved as well
+    a.getView(100, 200).saveCompressed(filename, chunkSize=7)
+    b.loadCompressed(filename)
+    assert b.tolist() == a.tolist()[100:200]
+
+    # empty array
+    array_type().saveCompressed(filename)
+    b.loadCompressed(filename)
+    assert b.getSize() == 0
+
+
+def test_compressed_serialization_errors(tmp_path: Path) -> None:
+    filename = str(tmp_path / "array.tnlz")
+    a = pytnl._containers.Array_float([1.0, 2.0, 3.0])
+    with pytest.raises(ValueError):
+        a.saveCompressed(filename, chunkSize=0)
+    with pytest.raises(ValueError):
+        a.saveCompressed(filename, level=10)
+
+    a.saveCompressed(filename)
+    with pytest.raises(ValueError):
+        pytnl._containers.Array_int().loadCompressed(filename)
+    with pytest.raises(IndexError):
+        pytnl._containers.Array_float().loadCompressed(filename, 2, 5)
+
+    # files written by `save` are not compressed files
+    a.save(filename)
+    with pytest.raises(ValueError):
+        pytnl._containers.Array_float().loadCompressed(filename)
+
+
+@pytest.mark.parametrize("array_type", array_types)
+@pytest.mark.parametrize("protocol", [2, 4, 5])
+@given(data=st.data())
+def test_pickle(array_type: type[A], protocol: int, data: st.DataObject) -> None:
+    v = data.draw(array_strategy(array_type))
+    v_loaded = pickle.loads(pickle.dumps(v, protocol=protocol))
+    assert type(v_loaded) is array_type
+    assert v_loaded == v
+
+
+@pytest.mark.parametrize("protocol", [2, 4, 5])
+def test_pickle_half_precision(protocol: int) -> None:
+    for array_type in (
+        pytnl._containers.Array_float16,
+        pytnl._containers.Vector_float16,
+        pytnl._containers.Array_bfloat16,
+        pytnl._containers.Vector_bfloat16,
+    ):
+        a = array_type([0.5, -1.25, 3.0, 1e4])
+        b = pickle.loads(pickle.dumps(a, protocol=protocol))
+        assert type(b) is array_type
+        assert b.tolist() == a.tolist()
+
+    # float16 data are passed out-of-band, bfloat16 (without a buffer format) in-band as bytes
+    buffers: list[pickle.PickleBuffer] = []
+    pickle.dumps(pytnl._containers.Array_float16(100, 1.0), protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    buffers.clear()
+    pickle.dumps(pytnl._containers.Array_bfloat16(100, 1.0), protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 0
+
+
+def test_pickle_out_of_band() -> None:
+    a = pytnl._containers.Vector_float([float(i) for i in range(1000)])
+    buffers: list[pickle.PickleBuffer] = []
+    data = pickle.dumps(a, protocol=5, buffer_callback=buffers.append)
+    # the elements are not in the pickle stream, but in one zero-copy buffer
+    assert len(data) < 1000
+    assert len(buffers) == 1
+    assert np.shares_memory(np.frombuffer(buffers[0], dtype=np.float64), np.from_dlpack(a))
+
+    b = pickle.loads(data, buffers=buffers)
+    assert type(b) is pytnl._containers.Vector_float
+    assert b == a
+
+    # the state can be any contiguous buffer of the right size
+    c = pytnl._containers.Array_int.__new__(pytnl._containers.Array_int)
+    c.__setstate__(np.arange(3, dtype=np.int64).tobytes())
+    assert c.tolist() == [0, 1, 2]
+    d = pytnl._containers.Array_int.__new__(pytnl._containers.Array_int)
+    with pytest.raises(ValueError):
+        d.__setstate__(b"12345")
@@ -0,0 +1,183 @@
+import copy
+
+import numpy as np
+import pytest
+from hypothesis import given
+from hypothesis import strategies as st
+
+from pytnl.containers import Array, BitArray, Vector
+
+# sizes around the word boundaries
+bool_lists = st.lists(st.booleans(), max_size=200)
+
+
+def create_bits(data: list[bool]) -> BitArray:
+    bits = BitArray(len(data))
+    for i, value in enumerate(data):
+        bits[i] = value
+    return bits
+
+
+def test_constructors() -> None:
+    assert BitArray().getSize() == 0
+    bits = BitArray(100)
+    assert len(bits) == 100
+    assert bits.getWordCount() == 2
+    assert not bits.any()
+    bits = BitArray(100, True)
+    assert bits.count() == 100
+    assert bits.all()
+    with pytest.raises(ValueError):
+        BitArray(-1)
+
+
+def test_words() -> None:
+    bits = BitArray(70, True)
+    words = bits.getWords()
+    assert words.dtype == np.uint64
+    assert list(words) == [2**64 - 1, 2**6 - 1]
+    # the words are read-only, so the bits past the size stay zero
+    with pytest.raises(ValueError):
+        words[1] = 2**64 - 1
+    assert not words.flags.writeable
+    del bits
+    assert words[1] == 2**6 - 1
+
+
+@given(data=bool_lists)
+def test_indexing(data: list[bool]) -> None:
+    bits = create_bits(data)
+    assert [bits[i] for i in range(len(data))] == data
+    if data:
+        assert bits[-1] == data[-1]
+    with pytest.raises(IndexError):
+        bits[len(data)]
+
+
+slices = st.builds(
+    slice,
+    st.none() | st.integers(-250, 250),
+    st.none() | st.integers(-250, 250),
+    st.none() | st.integers(-70, 70).filter(lambda step: step != 0),
+)
+
+
+def to_list(bits: BitArray) -> list[bool]:
+    return [bits[i] for i in range(len(bits))]
+
+
+@given(data=bool_lists, s=slices)
+def test_slice_getitem(data: list[bool], s: slice) -> None:
+    bits = create_bits(data)
+    result = bits[s]
+    assert isinstance(result, BitArray)
+    assert to_list(result) == data[s]
+    assert result.count() == sum(data[s])
+    # the result is a copy
+    result[:] = True
+    assert to_list(bits) == data
+
+
+@given(data=bool_lists, s=slices, value=st.booleans())
+def test_slice_setitem(data: list[bool], s: slice, value: bool) -> None:
+    bits = create_bits(data)
+    length = len(data[s])
+    source = [value != (i % 3 == 0) for i in range(length)]
+
+    expected = list(data)
+    expected[s] = source
+    bits[s] = create_bits(source)
+    assert to_list(bits) == expected
+    assert bits.count() == sum(expected)
+
+    bits = create_bits(data)
+    bits[s] = Array[bool](source)
+    assert to_list(bits) == expected
+
+    bits = create_bits(data)
+    expected = list(data)
+    expected[s] = [value] * length
+    bits[s] = value
+    assert to_list(bits) == expected
+    assert bits.count() == sum(expected)
+
+    with pytest.raises(ValueError):
+        bits[s] = create_bits(source + [value])
+
+
+@given(data=bool_lists)
+def test_slice_setitem_self(data: list[bool]) -> None:
+    bits = create_bits(data)
+    bits[1:] = bits[:-1]
+    expected = list(data)
+    expected[1:] = data[:-1]
+    assert to_list(bits) == expected
+    bits = create_bits(data)
+    bits[::-1] = bits
+    assert to_list(bits) == data[::-1]
+
+
+@given(data=bool_lists)
+def test_reductions(data: list[bool]) -> None:
+    bits = create_bits(data)
+    assert bits.count() == sum(data)
+    assert bits.any() == any(data)
+    assert bits.all() == all(data)
+
+
+@given(a=bool_lists, b=bool_lists)
+def test_bitwise_operators(a: list[bool], b: list[bool]) -> None:
+    size = min(len(a), len(b))
+    a, b = a[:size], b[:size]
+    x = create_bits(a)
+    y = create_bits(b)
+    assert list((x & y).toArray()) == [p and q for p, q in zip(a, b)]
+    assert list((x | y).toArray()) == [p or q for p, q in zip(a, b)]
+    assert list((x ^ y).toArray()) == [p != q for p, q in zip(a, b)]
+    assert list((~x).toArray()) == [not p for p in a]
+    # the bits past the end are not set by the negation
+    assert (~x).count() == size - sum(a)
+    assert x.count(y) == sum(p and q for p, q in zip(a, b))
+
+    z = copy.copy(x)
+    z &= y
+    assert z == x & y
+    z |= x
+    assert z == x
+
+
+def test_size_mismatch() -> None:
+    with pytest.raises(ValueError):
+        BitArray(10) & BitArray(11)
+    with pytest.raises(ValueError):
+        Vector[float](10).sum(BitArray(11))
+
+
+@given(data=bool_lists)
+def test_conversions(data: list[bool]) -> None:
+    array = Array[bool](len(data))
+    for i, value in enumerate(data):
+        array[i] = value
+    bits = BitArray(array)
+    assert bits == create_bits(data)
+    assert bits.toArray() == array
+
+    out = Array[bool](len(data), True)
+    bits.unpack(out)
+    assert out == array
+
+
+@given(data=bool_lists)
+def test_masked_operations(data: list[bool]) -> None:
+    mask = create_bits(data)
+    v = Vector[float](len(data))
+    for i in range(len(data)):
+        v[i] = i
+    assert v.sum(mask) == sum(i for i, value in enumerate(data) if value)
+
+    v.setValue(-1, mask)
+    assert list(v) == [-1 if value else i for i, value in enumerate(data)]
+
+    array = Array[int](len(data), 0)
+    array.setValue(5, mask)
+    assert list(array) == [5 if value else 0 for value in data]
@@ -0,0 +1,244 @@
+import copy
+from collections.abc import Iterator
+
+import numpy as np
+import pytest
+
+import pytnl._containers
+from pytnl.containers import CachingAllocator, HugePages, NDArray, NumaPolicy, isCopyOnWrite, setCopyOnWrite
+
+# Number of elements of the test vectors (8 MB of float data)
+SIZE = 2**20
+
+
+@pytest.fixture
+def caching() -> Iterator[None]:
+    """Enables the caching allocator for a test and restores the default state afterwards."""
+    CachingAllocator.setEnabled(True)
+    CachingAllocator.trim()
+    CachingAllocator.resetStatistics()
+    max_cached_bytes = CachingAllocator.getMaxCachedBytes()
+    try:
+        yield
+    finally:
+        CachingAllocator.setMaxCachedBytes(max_cached_bytes)
+        CachingAllocator.setEnabled(False)
+
+
+def test_disabled_by_default() -> None:
+    assert not CachingAllocator.isEnabled()
+    v = pytnl._containers.Vector_float(SIZE)
+    del v
+    assert CachingAllocator.getStatistics()["cachedBlocks"] == 0
+
+
+@pytest.mark.usefixtures("caching")
+def test_reuse() -> None:
+    a = pytnl._containers.Vector_float(SIZE)
+    a.setValue(1)
+
+    b = a + a
+    del b
+    stats = CachingAllocator.getStatistics()
+    assert stats["cachedBlocks"] >= 1
+    assert stats["cachedBytes"] >= SIZE * 8
+
+    # the next result of the same size reuses the cached block
+    c = a * 2
+    assert c == a + a
+    assert CachingAllocator.getStatistics()["hits"] >= 1
+
+    # the blocks are shared by all value types and containers
+    CachingAllocator.resetStatistics()
+    del c
+    nd = NDArray[2, float]()
+    nd.setSizes(SIZE // 2, 2)
+    assert CachingAllocator.getStatistics()["hits"] == 1
+
+
+@pytest.mark.usefixtures("caching")
+def test_trim() -> None:
+    v = pytnl._containers.Array_int(SIZE)
+    del v
+    assert CachingAllocator.getStatistics()["cachedBlocks"] == 1
+
+    CachingAllocator.trim()
+    stats = CachingAllocator.getStatistics()
+    assert stats["cachedBlocks"] == 0
+    assert stats["cachedBytes"] == 0
+    assert stats["releases"] == 1
+
+
+@pytest.mark.usefixtures("caching")
+def test_max_cached_bytes() -> None:
+    CachingAllocator.setMaxCachedBytes(SIZE)
+    v = pytnl._containers.Vector_float(SIZE)
+    del v
+    stats = CachingAllocator.getStatistics()
+    assert stats["cachedBlocks"] == 0
+    assert stats["releases"] == 1
+
+
+def test_exact_size_when_disabled() -> None:
+    # blocks allocated while caching is disabled are not rounded up, so they cannot be cached
+    v = pytnl._containers.Vector_float(SIZE + 1, 1.0)
+    CachingAllocator.setEnabled(True)
+    try:
+        CachingAllocator.resetStatistics()
+        del v
+        assert CachingAllocator.getStatistics()["cachedBlocks"] == 0
+        w = pytnl._containers.Vector_float(SIZE + 1, 2.0)
+    finally:
+        CachingAllocator.setEnabled(False)
+    # blocks rounded up while caching was enabled are released with their class size
+    assert w.sum() == 2.0 * (SIZE + 1)
+    del w
+    assert CachingAllocator.getStatistics()["cachedBlocks"] == 0
+
+
+@pytest.mark.parametrize("policy", [HugePages.NONE, HugePages.TRANSPARENT, HugePages.EXPLICIT])
+def test_huge_pages(policy: HugePages) -> None:
+    CachingAllocator.setHugePages(policy)
+    try:
+        assert CachingAllocator.getHugePages() == policy
+        assert CachingAllocator.getHugePageThreshold() == 2**21
+
+        # large blocks are aligned to huge pages, small blocks to cache lines
+        large = pytnl._containers.Vector_float(SIZE)
+        small = pytnl._containers.Vector_float(10)
+        assert np.from_dlpack(large).ctypes.data % 2**21 == 0
+        assert np.from_dlpack(small).ctypes.data % 64 == 0
+
+        large.setValue(1)
+        assert large[0] == large[SIZE - 1] == 1
+        assert large + large == 2 * large
+    finally:
+        CachingAllocator.setHugePages(HugePages.NONE)
+
+
+@pytest.mark.parametrize("policy", list(NumaPolicy))
+def test_numa_policy(policy: NumaPolicy) -> None:
+    CachingAllocator.setNumaPolicy(policy)
+    try:
+        assert CachingAllocator.getNumaPolicy() == policy
+        assert CachingAllocator.getNumaNode() == 0
+
+        # the placement does not change the contents of new arrays
+        nd = NDArray[3, float]()
+        nd.setSizes(64, 64, 64)
+        nd.setValue(3)
+        assert nd[63, 63, 63] == 3
+        v = pytnl._containers.Vector_float([1.0] * SIZE)
+        assert v[SIZE - 1] == 1
+    finally:
+        CachingAllocator.setNumaPolicy(NumaPolicy.DEFAULT)
+
+
+def test_numa_policy_invalid_node() -> None:
+    with pytest.raises(ValueError):
+        CachingAllocator.setNumaPolicy(NumaPolicy.BIND, node=64)
+
+
+@pytest.fixture
+def copy_on_write() -> Iterator[None]:
+    """Enables the copy-on-write copies for a test and restores the default state afterwards."""
+    setCopyOnWrite(True)
+    try:
+        yield
+    finally:
+        setCopyOnWrite(False)
+
+
+@pytest.mark.usefixtures("copy_on_write")
+def test_copy_on_write() -> None:
+    assert isCopyOnWrite()
+    v = pytnl._containers.Vector_float(10, 1.0)
+    c = copy.copy(v)
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 1
+
+    # the first modification copies the data, the original is not affected
+    c[0] = 2
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    assert v[0] == 1
+    assert c[0] == 2
+    assert list(c)[1:] == list(v)[1:]
+
+    # in-place operators and writable views detach the copies too
+    c = copy.copy(v)
+    c += 1
+    assert v == pytnl._containers.Vector_float(10, 1.0)
+    c = copy.copy(v)
+    c.getView().setValue(3)
+    assert v == pytnl._containers.Vector_float(10, 1.0)
+
+    # deep copies never share the data
+    d = copy.deepcopy(v)
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    del d
+
+
+@pytest.mark.usefixtures("copy_on_write")
+def test_copy_on_write_release() -> None:
+    v = pytnl._containers.Vector_float(10, 1.0)
+    c = copy.copy(v)
+    # the block is released by the last owner
+    del v
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    assert c == pytnl._containers.Vector_float(10, 1.0)
+    c.setValue(2)
+    assert c[9] == 2
+
+
+@pytest.mark.usefixtures("copy_on_write")
+def test_copy_on_write_ndarray() -> None:
+    a = NDArray[2, float]()
+    a.setSizes(4, 5)
+    a.setValue(1)
+    b = copy.copy(a)
+    assert b.getSizes() == a.getSizes()
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 1
+    b[1, 2] = 5
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    assert a[1, 2] == 1
+    assert b[1, 2] == 5
+
+
+@pytest.mark.usefixtures("copy_on_write")
+def test_copy_on_write_existing_exports() -> None:
+    # writable views and exports made before the copy write into the data of the original
+    v = pytnl._containers.Vector_float(10, 1.0)
+    view = v.getView()
+    c = copy.copy(v)
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    view[0] = 2
+    assert v[0] == 2
+    assert c[0] == 1
+
+    v = pytnl._containers.Vector_float(10, 1.0)
+    data = np.from_dlpack(v)
+    c = copy.copy(v)
+    data[1] = 3
+    assert v[1] == 3
+    assert c[1] == 1
+
+    v = pytnl._containers.Vector_float(10, 1.0)
+    buffer = np.asarray(v)
+    strided = v[::2]
+    c = copy.copy(v)
+    buffer[2] = 4
+    strided[2] = 5
+    assert list(c) == [1.0] * 10
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+
+    # an export made after the copy detaches the array first
+    v = pytnl._containers.Vector_float(10, 1.0)
+    c = copy.copy(v)
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 1
+    np.from_dlpack(c)[0] = 6
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 0
+    assert v[0] == 1
+    # the exported array is not shared by further copies, the original still is
+    d = copy.copy(c)
+    e = copy.copy(v)
+    assert CachingAllocator.getStatistics()["sharedBlocks"] == 1
+    del d, e
@@ -0,0 +1,159 @@
+import cmath
+import math
+
+import pytest
+from hypothesis import given
+from hypothesis import strategies as st
+
+import pytnl._containers
+from pytnl.containers import Expression, Vector, lazy
+from pytnl.containers import expressions
+
+# ----------------------
+# Helper Functions
+# ----------------------
+
+
+def create_vector(data: list[float]) -> pytnl._containers.Vector_float:
+    v = Vector[float](len(data))
+    for i, val in enumerate(data):
+        v[i] = val
+    return v
+
+
+# ----------------------
+# Hypothesis Strategies
+# ----------------------
+
+# sizes spanning several evaluation blocks
+sizes = st.integers(min_value=1, max_value=1000)
+floats = st.floats(min_value=-1e3, max_value=1e3, allow_nan=False, allow_infinity=False)
+
+
+@st.composite
+def vectors(draw: st.DrawFn, count: int) -> list[list[float]]:
+    size = draw(sizes)
+    return [draw(st.lists(floats, min_size=size, max_size=size)) for _ in range(count)]
+
+
+# ----------------------
+# Tests
+# ----------------------
+
+
+@given(data=vectors(4), scalar=floats)
+def test_eval(data: list[list[float]], scalar: float) -> None:
+    a, b, c, d = (create_vector(x) for x in data)
+    e = lazy(a) * b + lazy(c) * d - scalar
+    assert isinstance(e, Expression)
+    assert len(e) == len(data[0])
+
+    result = e.eval()
+    assert isinstance(result, pytnl._containers.Vector_float)
+    for i in range(len(data[0])):
+        expected = data[0][i] * data[1][i] + data[2][i] * data[3][i] - scalar
+        assert result[i] == pytest.approx(expected)
+
+
+@given(data=vectors(2))
+def test_eval_into_operand(data: list[list[float]]) -> None:
+    a, b = (create_vector(x) for x in data)
+    out = (2.0 * lazy(a) - b / 4.0).eval(out=a)
+    assert out is a
+    for i in range(len(data[0])):
+        assert a[i] == pytest.approx(2.0 * data[0][i] - data[1][i] / 4.0)
+
+
+def test_eval_into_view() -> None:
+    a = Vector[float](10, 1.0)
+    b = Vector[float](10, 0.0)
+    (lazy(a) + 1.0).eval(out=b.getView())
+    assert list(b) == [2.0] * 10
+
+
+def test_operands_are_referenced() -> None:
+    a = Vector[float](10, 1.0)
+    e = lazy(a) + 1.0
+    a.setValue(2.0)
+    assert e.sum() == 30.0
+
+
+@given(data=vectors(2))
+def test_reductions(data: list[list[float]]) -> None:
+    a, b = (create_vector(x) for x in data)
+    e = lazy(a) - b
+    values = [x - y for x, y in zip(data[0], data[1], strict=True)]
+
+    assert e.sum() == pytest.approx(math.fsum(values), abs=1e-6)
+    assert e.min() == min(values)
+    assert e.max() == max(values)
+    assert e.l1Norm() == pytest.approx(math.fsum(abs(x) for x in values), abs=1e-6)
+    assert e.l2Norm() == pytest.approx(math.sqrt(math.fsum(x * x for x in values)), abs=1e-6)
+    assert e.maxNorm() == max(abs(x) for x in values)
+
+
+def test_product() -> None:
+    a = Vector[int](10, 2)
+    assert (lazy(a) + 1).product() == 3**10
+
+
+def test_functions() -> None:
+    a = Vector[float](5, 0.25)
+    b = Vector[float](5, 0.5)
+    assert list(expressions.sqrt(a).eval()) == [0.5] * 5
+    assert list(expressions.exp(a).eval()) == pytest.approx([math.exp(0.25)] * 5)
+    assert list(expressions.log(a).eval()) == pytest.approx([math.log(0.25)] * 5)
+    assert list(expressions.sin(a).eval()) == pytest.approx([math.sin(0.25)] * 5)
+    assert list(expressions.cos(a).eval()) == pytest.approx([math.cos(0.25)] * 5)
+    assert list(expressions.minimum(a, b).eval()) == [0.25] * 5
+    assert list(expressions.maximum(0.75, b).eval()) == [0.75] * 5
+    assert list(abs(-lazy(a)).eval()) == [0.25] * 5
+
+
+def test_complex() -> None:
+    a = Vector[complex](4, 1 + 2j)
+    e = lazy(a) * 1j + 1
+    assert list(e.eval()) == [-1 + 1j] * 4
+    assert e.sum() == 4 * (-1 + 1j)
+    assert e.l2Norm() == pytest.approx(math.sqrt(4 * 2))
+    assert e.maxNorm() == pytest.approx(abs(-1 + 1j))
+    assert list(expressions.exp(a).eval()) == pytest.approx([cmath.exp(1 + 2j)] * 4)
+    with pytest.raises(TypeError):
+        e.max()
+    with pytest.raises(TypeError):
+        expressions.minimum(a, a).eval()
+
+
+def test_empty() -> None:
+    a = Vector[float](0)
+    e = lazy(a) + 1.0
+    assert e.eval().getSize() == 0
+    assert e.sum() == 0.0
+    with pytest.raises(ValueError):
+        e.min()
+
+
+def test_size_mismatch() -> None:
+    a = Vector[float](10)
+    b = Vector[float](11)
+    with pytest.raises(ValueError):
+        (lazy(a) + b).eval()
+    with pytest.raises(ValueError):
+        lazy(a).eval(out=b)
+
+
+def test_type_mismatch() -> None:
+    a = Vector[float](10)
+    b = Vector[int](10)
+    with pytest.raises(TypeError):
+        lazy(a) + b  # pyright: ignore[reportUnusedExpression]
+    with pytest.raises(TypeError):
+        lazy(b) + 1.5  # pyright: ignore[reportUnusedExpression]
+    with pytest.raises(TypeError):
+        lazy(b).eval(out=a)
+    with pytest.raises(TypeError):
+        lazy(a).eval(out=a.getConstView())
+    with pytest.raises(TypeError):
+        lazy([1.0, 2.0])
+    with pytest.raises(TypeError):
+        expressions.sqrt(b).eval()
@@ -0,0 +1,125 @@
+import sys
+import threading
+from collections.abc import Callable, Iterator
+
+import pytest
+
+from pytnl.containers import Array, NDArray, Vector
+
+# ----------------------
+# Configuration
+# ----------------------
+
+# Number of elements safely above the GIL release threshold in the bindings
+LARGE_SIZE = 2**22
+
+# Number of repetitions of the operation in the worker thread
+ROUNDS = 8
+
+
+def _array_setValue() -> Callable[[], object]:
+    a = Array[float](LARGE_SIZE)
+    return lambda: a.setValue(1.0)
+
+
+def _array_assign() -> Callable[[], object]:
+    a = Array[float](LARGE_SIZE, 1.0)
+    b = Array[float](LARGE_SIZE)
+    return lambda: b.assign(a)
+
+
+def _array_eq() -> Callable[[], object]:
+    a = Array[float](LARGE_SIZE, 1.0)
+    b = Array[float](LARGE_SIZE, 1.0)
+    return lambda: a == b
+
+
+def _vector_add() -> Callable[[], object]:
+    a = Vector[float](LARGE_SIZE, 1.0)
+    b = Vector[float](LARGE_SIZE, 2.0)
+    return lambda: a + b
+
+
+def _vector_iadd() -> Callable[[], object]:
+    a = Vector[float](LARGE_SIZE, 1.0)
+    return lambda: a.__iadd__(1.0)
+
+
+def _ndarray_setValue() -> Callable[[], object]:
+    a = NDArray[2, float]()
+    a.setSizes(2**11, 2**11)
+    return lambda: a.setValue(1.0)
+
+
+OPERATIONS = [
+    _array_setValue,
+    _array_assign,
+    _array_eq,
+    _vector_add,
+    _vector_iadd,
+    _ndarray_setValue,
+]
+
+
+@pytest.fixture
+def no_forced_gil_switch() -> Iterator[None]:
+    """
+    Make the interpreter practically never force a GIL switch between threads,
+    so another thread can run only when the GIL is released explicitly.
+    """
+    old = sys.getswitchinterval()
+    sys.setswitchinterval(1000)
+    try:
+        yield
+    finally:
+        sys.setswitchinterval(old)
+
+
+# ----------------------
+# Tests
+# ----------------------
+
+
+@pytest.mark.usefixtures("no_forced_gil_switch")
+@pytest.mark.parametrize("make_operation", OPERATIONS)
+def test_gil_released_for_large_arrays(make_operation: Callable[[], Callable[[], object]]) -> None:
+    operation = make_operation()
+    done = threading.Event()
+
+    def worker() -> None:
+        for _ in range(ROUNDS):
+            operation()
+        done.set()
+
+    thread = threading.Thread(target=worker)
+    # `start` waits until the worker is running, then the main thread needs the
+    # GIL back. Without forced switching, it gets the GIL before the worker is
+    # done only if the binding released the GIL during the bulk operation.
+    thread.start()
+    main_progressed_concurrently = not done.is_set()
+    thread.join()
+
+    assert main_progressed_concurrently
+
+
+def test_concurrent_operations_are_correct() -> None:
+    size = 2**20
+    threads_count = 4
+    vectors = [Vector[float](size, float(i)) for i in range(threads_count)]
+    results: list[float] = [0.0] * threads_count
+
+    def worker(i: int) -> None:
+        v = vectors[i]
+        for _ in range(ROUNDS):
+            v += 1.0
+        w = v * 2.0
+        results[i] = w[size - 1]
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(threads_count)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    for i in range(threads_count):
+        assert results[i] == 2.0 * (i + ROUNDS)
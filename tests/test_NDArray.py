@@ -1,5 +1,7 @@
 import copy
+import pickle
 from collections.abc import Callable
+from pathlib import Path
 from typing import Any, cast
 
 import numpy as np
@@ -517,3 +519,97 @@ def test_dlpack(shape: tuple[int, ...]) -> None:
     assert const_view_np.shape == shape, f"Expected shape {shape}, got {const_view_np.shape}"
     assert const_view_np.dtype == array_np.dtype
     assert np.all(const_view_np == array_np), "Data mismatch in NumPy array from const view"
+
+
+@pytest.mark.parametrize("shape", SHAPE_PARAMS)
+def test_view_from_numpy(shape: tuple[int, ...]) -> None:
+    """
+    Tests zero-copy construction of NDArrayView from a NumPy array.
+    """
+    dim = len(shape)
+    assert is_dim_guard(dim)
+
+    array_np = np.arange(np.prod(shape), dtype=np.float64).reshape(shape)
+    view = NDArrayView[dim, float](array_np)  # type: ignore[index, call-arg]
+
+    assert view.getSizes() == shape
+    strides = tuple(s // array_np.dtype.itemsize for s in array_np.strides)
+    assert view.getStrides() == strides
+    for idx in np.ndindex(shape):
+        assert view[idx] == array_np[idx]
+
+    # the memory is shared in both directions
+    idx = (0,) * dim
+    array_np[idx] = -1
+    assert view[idx] == -1
+    view[idx] = 99
+    assert array_np[idx] == 99
+    assert np.shares_memory(np.from_dlpack(view), array_np)
+
+    # no implicit copies of non-contiguous or mismatched arrays
+    with pytest.raises(TypeError):
+        NDArrayView[dim, float](array_np.astype(np.float32))  # type: ignore[index, call-arg]
+    if dim > 1:
+        with pytest.raises(TypeError):
+            NDArrayView[dim, float](array_np.T)  # type: ignore[index, call-arg]
+
+
+@pytest.mark.parametrize("shape", SHAPE_PARAMS)
+def test_compressed_serialization(shape: tuple[int, ...], tmp_path: Path) -> None:
+    dim = len(shape)
+    assert is_dim_guard(dim)
+    filename = str(tmp_path / "ndarray.tnlz")
+
+    array = NDArray[dim, float]()  # type: ignore[index]
+    array.setSizes(*shape)
+    array_np = np.from_dlpack(array)
+    array_np[...] = np.arange(array_np.size).reshape(shape)
+    array.saveCompressed(filename, chunkSize=7)
+
+    loaded = NDArray[dim, float]()  # type: ignore[index]
+    loaded.loadCompressed(filename)
+    assert loaded.getSizes() == shape
+    assert loaded == array
+
+    # load a slab of the first dimension
+    loaded.loadCompressed(filename, 1, 3)
+    assert loaded.getSizes() == (2, *shape[1:])
+    assert np.array_equal(np.from_dlpack(loaded), array_np[1:3])
+
+    with pytest.raises(ValueError):
+        NDArray[dim, int]().loadCompressed(filename)  # type: ignore[index]
+
+
+@pytest.mark.parametrize("shape", SHAPE_PARAMS)
+@pytest.mark.parametrize("protocol", [4, 5])
+def test_pickle(shape: tuple[int, ...], protocol: int) -> None:
+    dim = len(shape)
+    assert is_dim_guard(dim)
+
+    array = NDArray[dim, float]()  # type: ignore[index]
+    array.setSizes(*shape)
+    array_np = np.from_dlpack(array)
+    array_np[...] = np.arange(array_np.size).reshape(shape)
+
+    loaded = pickle.loads(pickle.dumps(array, protocol=protocol))
+    assert type(loaded) is type(array)
+    assert loaded.getSizes() == shape
+    assert loaded == array
+
+
+@pytest.mark.parametrize("shape", SHAPE_PARAMS)
+def test_random(shape: tuple[int, ...]) -> None:
+    dim = len(shape)
+    assert is_dim_guard(dim)
+
+    array = NDArray[dim, float]()  # type: ignore[index]
+    array.setSizes(*shape)
+    array.setRandomUniform(seed=3)
+
+    # the elements are filled in the order of the storage array
+    storage = pytnl._containers.Vector_float(array.getStorageSize())
+    storage.setRandomUniform(seed=3)
+    assert np.array_equal(np.from_dlpack(array).ravel(), np.from_dlpack(storage))
+
+    array.setRandomNormal(seed=3)
+    assert np.all(np.isfinite(np.from_dlpack(array)))
@@ -1,8 +1,10 @@
 from collections.abc import Callable
 from typing import Any
 
+import numpy as np
 import pytest
 
+import pytnl._solvers
 from pytnl.containers import Vector
 from pytnl.solvers import ODESolver, ode_methods
 
@@ -131,6 +133,28 @@ def test_heat_equation_adaptive(method: type) -> None:
     assert solution[n - 1] == 0.0, f"{method.__name__}: right boundary condition violated"
 
 
+def test_heat_equation_float32() -> None:
+    """1D heat equation solved in single precision."""
+    u_double, rhs, tau, output_time_step, final_t = _setup_heat_equation()
+    n = u_double.getSize()
+    u = Vector[np.float32](n)
+    for i in range(n):
+        u[i] = u_double[i]
+
+    solver = ODESolver[ode_methods.Euler_float32]()
+    assert isinstance(solver, pytnl._solvers.ODESolver_Euler_float32)
+    solver.setTau(tau)
+    solver.setTime(0.0)
+    while solver.getTime() < final_t:
+        solver.setStopTime(min(solver.getTime() + output_time_step, final_t))
+        assert solver.solve(u, rhs)
+
+    _, expected = _solve_heat_equation(ode_methods.Euler)
+    assert max(u) < 1.0
+    for i in range(n):
+        assert u[i] == pytest.approx(expected[i], abs=1e-4)
+
+
 def test_solver_properties() -> None:
     """Verify getter/setter pairs and isStatic on ODESolver[ode_methods.Euler]."""
     solver = ODESolver[ode_methods.Euler]()
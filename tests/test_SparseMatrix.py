@@ -0,0 +1,177 @@
+# pyright: reportAttributeAccessIssue=none, reportUnknownArgumentType=none, reportUnknownMemberType=none, reportUnknownVariableType=none
+
+import pickle
+from typing import Any
+
+import numpy as np
+import pytest
+
+import pytnl._containers
+from pytnl.containers import Vector
+from pytnl.matrices import (
+    CSR,
+    CSR_index32,
+    Ellpack,
+    Ellpack_index32,
+    SlicedEllpack,
+    SlicedEllpack_index32,
+    copySparseMatrix,
+)
+
+# pairs of formats with 64-bit and 32-bit column indices
+format_pairs = [
+    (CSR, CSR_index32),
+    (Ellpack, Ellpack_index32),
+    (SlicedEllpack, SlicedEllpack_index32),
+]
+
+
+def tridiagonal(matrix_type: type[Any], n: int) -> Any:  # noqa: ANN401
+    """Create the tridiagonal matrix with 2 on the diagonal and -1 next to it."""
+    matrix = matrix_type()
+    matrix.setDimensions(n, n)
+    matrix.setRowCapacities(Vector[int](n, 3))
+    for i in range(n):
+        if i > 0:
+            matrix.setElement(i, i - 1, -1.0)
+        matrix.setElement(i, i, 2.0)
+        if i < n - 1:
+            matrix.setElement(i, i + 1, -1.0)
+    return matrix
+
+
+def dense(matrix: Any) -> list[list[float]]:  # noqa: ANN401
+    return [[matrix.getElement(i, j) for j in range(matrix.getColumns())] for i in range(matrix.getRows())]
+
+
+@pytest.mark.parametrize("matrix64_type, matrix32_type", format_pairs)
+def test_index32_construction(matrix64_type: type[Any], matrix32_type: type[Any]) -> None:
+    n = 10
+    matrix = tridiagonal(matrix32_type, n)
+    assert matrix.getRows() == n
+    assert matrix.getColumns() == n
+    assert matrix.getNonzeroElementsCount() == 3 * n - 2
+    assert dense(matrix) == dense(tridiagonal(matrix64_type, n))
+
+    capacities = Vector[int]()
+    matrix.getRowCapacities(capacities)
+    assert list(capacities) == [3] * n
+
+
+@pytest.mark.parametrize("matrix64_type, matrix32_type", format_pairs)
+def test_index32_vectorProduct(matrix64_type: type[Any], matrix32_type: type[Any]) -> None:
+    n = 50
+    matrix64 = tridiagonal(matrix64_type, n)
+    matrix32 = tridiagonal(matrix32_type, n)
+    x = Vector[float](np.linspace(0, 1, n))
+    y64 = Vector[float](n)
+    y32 = Vector[float](n)
+    matrix64.vectorProduct(x, y64)
+    matrix32.vectorProduct(x, y32)
+    assert y32 == y64
+
+
+@pytest.mark.parametrize("matrix64_type, matrix32_type", format_pairs)
+def test_index32_copySparseMatrix(matrix64_type: type[Any], matrix32_type: type[Any]) -> None:
+    n = 20
+    matrix64 = tridiagonal(matrix64_type, n)
+
+    matrix32 = matrix32_type()
+    copySparseMatrix(matrix32, matrix64)
+    assert dense(matrix32) == dense(matrix64)
+
+    back = matrix64_type()
+    copySparseMatrix(back, matrix32)
+    assert back == matrix64
+
+    # conversions from CSR
+    if matrix32_type is not CSR_index32:
+        matrix32 = matrix32_type()
+        copySparseMatrix(matrix32, tridiagonal(CSR, n))
+        assert dense(matrix32) == dense(matrix64)
+
+
+@pytest.mark.parametrize("matrix32_type", [CSR_index32, Ellpack_index32, SlicedEllpack_index32])
+def test_index32_copySparseMatrix_overflow(matrix32_type: type[Any]) -> None:
+    # one row is enough to exceed the 32-bit range of the columns
+    matrix = CSR()
+    matrix.setDimensions(1, 2**31)
+    matrix.setRowCapacities(Vector[int](1, 1))
+    matrix.setElement(0, 2**31 - 1, 1.0)
+    with pytest.raises(OverflowError):
+        copySparseMatrix(matrix32_type(), matrix)
+
+
+def test_index32_copySparseMatrix_storage_overflow() -> None:
+    # Ellpack stores rows * (maximum row length) elements, which exceeds the
+    # 32-bit range although the number of nonzero elements does not
+    rows = 2**20
+    length = 2**12
+    capacities = Vector[int](rows, 0)
+    capacities[0] = length
+    matrix = CSR()
+    matrix.setDimensions(rows, length)
+    matrix.setRowCapacities(capacities)
+    for j in range(length):
+        matrix.setElement(0, j, 1.0)
+    assert matrix.getNonzeroElementsCount() == length
+
+    with pytest.raises(OverflowError):
+        copySparseMatrix(Ellpack_index32(), matrix)
+
+    # CSR and SlicedEllpack store only the rows (or slices) with long rows
+    for matrix32_type in (CSR_index32, SlicedEllpack_index32):
+        matrix32 = matrix32_type()
+        copySparseMatrix(matrix32, matrix)
+        assert matrix32.getNonzeroElementsCount() == length
+
+
+@pytest.mark.parametrize("matrix64_type, matrix32_type", format_pairs)
+def test_index32_internal_vectors(matrix64_type: type[Any], matrix32_type: type[Any]) -> None:
+    n = 10
+    matrix64 = tridiagonal(matrix64_type, n)
+    matrix32 = tridiagonal(matrix32_type, n)
+
+    values = matrix32.getValues()
+    assert isinstance(values, pytnl._containers.VectorView_float)
+    assert list(values) == list(matrix64.getValues())
+
+    columns = matrix32.getColumnIndexes()
+    assert isinstance(columns, pytnl._containers.VectorView_int32)
+    assert np.from_dlpack(columns).dtype == np.int32
+    assert list(columns) == list(matrix64.getColumnIndexes())
+
+    # the views refer to the data of the matrix
+    values[0] = 5.0
+    assert matrix32.getValues()[0] == 5.0
+
+    if matrix32_type is CSR_index32:
+        offsets = matrix32.getSegments().getOffsets()
+        assert isinstance(offsets, pytnl._containers.VectorView_int32_const)
+        assert list(offsets) == list(matrix64.getSegments().getOffsets())
+
+
+@pytest.mark.parametrize("matrix_type", [CSR, Ellpack, SlicedEllpack])
+def test_pickle(matrix_type: type[Any]) -> None:
+    matrix = tridiagonal(matrix_type, 10)
+    for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+        restored = pickle.loads(pickle.dumps(matrix, protocol=protocol))
+        assert type(restored) is matrix_type
+        assert restored == matrix
+        assert dense(restored) == dense(matrix)
+
+    # the state is set on an uninitialized instance, as in `pickle.loads`
+    state = matrix.__reduce_ex__(2)[2]
+    restored = matrix_type.__new__(matrix_type)
+    restored.__setstate__(state)
+    assert dense(restored) == dense(matrix)
+
+
+@pytest.mark.parametrize("matrix32_type", [CSR_index32, Ellpack_index32, SlicedEllpack_index32])
+def test_index32_pickle(matrix32_type: type[Any]) -> None:
+    matrix = tridiagonal(matrix32_type, 10)
+    for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+        restored = pickle.loads(pickle.dumps(matrix, protocol=protocol))
+        assert type(restored) is matrix32_type
+        assert restored == matrix
+        assert dense(restored) == dense(matrix)
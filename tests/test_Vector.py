@@ -3,12 +3,14 @@ import math
 from collections.abc import Collection
 from typing import TypeVar, cast
 
+import numpy as np
 import pytest
 from hypothesis import assume, given
 from hypothesis import strategies as st
 
 import pytnl._containers
 import pytnl.containers
+import pytnl.containers.reductions
 
 # ----------------------
 # Configuration
@@ -536,6 +538,209 @@ def test_imod_scalar(vector_type: type[Vint], data: st.DataObject) -> None:
         assert v[i] == int(math.fmod(original_v[i], s))
 
 
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_inplace_operators_do_not_allocate(vector_type: type[V]) -> None:
+    v = vector_type(10, 4)
+    original = v
+    v += 2
+    v -= 1
+    v *= 3
+    v /= 5
+    assert v is original
+    assert list(v) == [3] * 10
+
+
+@pytest.mark.parametrize("vector_type", [t for t in vector_types if t.ValueType is int])
+@given(data=st.data())
+def test_inplace_bitwise_vector(vector_type: type[Vint], data: st.DataObject) -> None:
+    v1, v2 = data.draw(vector_pair_strategy(vector_type))
+    original_v1 = copy.deepcopy(v1)
+    v = v1
+    v &= v2
+    assert v is v1
+    for i in range(v1.getSize()):
+        assert v1[i] == original_v1[i] & v2[i]
+    v1.assign(original_v1)
+    v1 |= v2
+    for i in range(v1.getSize()):
+        assert v1[i] == original_v1[i] | v2[i]
+    v1.assign(original_v1)
+    v1 ^= v2
+    for i in range(v1.getSize()):
+        assert v1[i] == original_v1[i] ^ v2[i]
+
+
+@pytest.mark.parametrize("vector_type", [t for t in vector_types if t.ValueType is int])
+@given(data=st.data())
+def test_inplace_bitwise_scalar(vector_type: type[Vint], data: st.DataObject) -> None:
+    v, s = data.draw(vector_scalar_strategy(vector_type))
+    assert isinstance(s, int)
+    original_v = copy.deepcopy(v)
+    v &= s
+    for i in range(v.getSize()):
+        assert v[i] == original_v[i] & s
+    v.assign(original_v)
+    v |= s
+    for i in range(v.getSize()):
+        assert v[i] == original_v[i] | s
+    v.assign(original_v)
+    v ^= s
+    for i in range(v.getSize()):
+        assert v[i] == original_v[i] ^ s
+
+
+# ----------------------
+# Functions with the output argument
+# ----------------------
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+@given(data=st.data())
+def test_out_functions_vector(vector_type: type[V], data: st.DataObject) -> None:
+    v1, v2 = data.draw(vector_pair_strategy(vector_type))
+    out = vector_type(v1.getSize())
+    pytnl.containers.add(v1, v2, out=out)
+    for i in range(v1.getSize()):
+        assert out[i] == v1[i] + v2[i]
+    pytnl.containers.sub(v1, v2, out=out)
+    for i in range(v1.getSize()):
+        assert out[i] == v1[i] - v2[i]
+    pytnl.containers.mul(v1, v2, out=out)
+    for i in range(v1.getSize()):
+        assert out[i] == pytest.approx(v1[i] * v2[i])
+    pytnl.containers.neg(v1, out=out)
+    for i in range(v1.getSize()):
+        assert out[i] == -v1[i]
+    pytnl.containers.abs(v1, out=out)
+    for i in range(v1.getSize()):
+        assert out[i] == abs(v1[i])
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+@given(data=st.data())
+def test_out_functions_scalar(vector_type: type[V], data: st.DataObject) -> None:
+    v, s = data.draw(vector_scalar_strategy(vector_type))
+    out = vector_type(v.getSize())
+    pytnl.containers.add(v, s, out=out)  # type: ignore[call-overload]
+    for i in range(v.getSize()):
+        assert out[i] == v[i] + s
+    pytnl.containers.sub(s, v, out=out)  # type: ignore[call-overload]
+    for i in range(v.getSize()):
+        assert out[i] == s - v[i]
+    pytnl.containers.mul(v, s, out=out)  # type: ignore[call-overload]
+    for i in range(v.getSize()):
+        assert out[i] == pytest.approx(v[i] * s)
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_out_functions_views(vector_type: type[V]) -> None:
+    v = vector_type(10, 1)
+    out = vector_type(20, 0)
+    # write into the second half of `out` through a view
+    pytnl.containers.add(v.getView(), v.getConstView(), out=out.getView(10, 20))
+    assert list(out) == [0] * 10 + [2] * 10
+    # the output may alias the input
+    pytnl.containers.mul(v, 3, out=v)  # type: ignore[call-overload]
+    assert list(v) == [3] * 10
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_out_functions_size_mismatch(vector_type: type[V]) -> None:
+    v = vector_type(10)
+    out = vector_type(11)
+    with pytest.raises(ValueError):
+        pytnl.containers.add(v, v, out=out)
+    with pytest.raises(ValueError):
+        pytnl.containers.axpy(1, v, out)  # type: ignore[call-overload]
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_axpy_axpby(vector_type: type[V]) -> None:
+    x = vector_type(10, 2)
+    y = vector_type(10, 1)
+    original = y
+    pytnl.containers.axpy(3, x, y)  # type: ignore[call-overload]
+    assert y is original
+    assert list(y) == [7] * 10
+    pytnl.containers.axpby(2, x, -1, y)  # type: ignore[call-overload]
+    assert list(y) == [-3] * 10
+
+
+# ----------------------
+# Operators on views
+# ----------------------
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+@given(data=st.data())
+def test_view_binary_operators(vector_type: type[V], data: st.DataObject) -> None:
+    v1, v2 = data.draw(vector_pair_strategy(vector_type))
+    view = v1.getView()
+    const_view = v2.getConstView()
+    for result in [view + const_view, view + v2, v1 + const_view, const_view + view]:
+        assert isinstance(result, vector_type)
+        for i in range(v1.getSize()):
+            assert result[i] == v1[i] + v2[i]
+    result = const_view * 2
+    assert isinstance(result, vector_type)
+    for i in range(v2.getSize()):
+        assert result[i] == pytest.approx(v2[i] * 2)
+    assert view == v1
+    assert (const_view != v2) is False
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_view_inplace_operators(vector_type: type[V]) -> None:
+    v = vector_type(10, 1)
+    other = vector_type(5, 2)
+    # modify the second half of the vector through a view
+    view = v.getView(5, 10)
+    original = view
+    view += other.getConstView()
+    view *= 3
+    view -= other
+    assert view is original
+    assert list(v) == [1] * 5 + [7] * 5
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_const_view_inplace_operators(vector_type: type[V]) -> None:
+    v = vector_type(10, 1)
+    view = v.getConstView()
+    with pytest.raises(TypeError):
+        view += 1  # type: ignore[operator]
+    with pytest.raises(TypeError):
+        view *= v  # type: ignore[operator]
+    assert list(v) == [1] * 10
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_operators_size_mismatch(vector_type: type[V]) -> None:
+    v = vector_type(10)
+    with pytest.raises(ValueError):
+        v + v.getConstView(0, 5)  # pyright: ignore[reportUnusedExpression]
+    with pytest.raises(ValueError):
+        v += v.getView(0, 5)
+
+
+@pytest.mark.parametrize("vector_type", vector_types)
+def test_view_slicing(vector_type: type[V]) -> None:
+    v = vector_type(10)
+    for i in range(10):
+        v[i] = i
+    view = v.getView()
+    s = view[2:8:2]
+    assert list(s) == [2, 4, 6]
+    assert isinstance(view[2:8], vector_type.ViewType)
+    assert isinstance(view[2:8] + 1, vector_type)
+    view[0:3] = vector_type(3, 0)
+    assert list(v) == [0, 0, 0, 3, 4, 5, 6, 7, 8, 9]
+    const_view = v.getConstView()
+    assert list(const_view[7:]) == [7, 8, 9]
+    with pytest.raises(TypeError):
+        const_view[0:3] = vector_type(3, 0)  # type: ignore[call-overload]
+
+
 # ----------------------
 # Comparison operators
 # ----------------------
@@ -661,3 +866,244 @@ def test_ceil(vector_type: type[Vreal], data: st.DataObject) -> None:
     assert isinstance(v2, vector_type)
     for i in range(v.getSize()):
         assert v2[i] == math.ceil(v[i])
+
+
+# ----------------------
+# Reductions
+# ----------------------
+
+
+@pytest.mark.parametrize("vector_type", real_vector_types)
+@given(data=st.data())
+def test_reductions(vector_type: type[Vreal], data: st.DataObject) -> None:
+    values = data.draw(st.lists(st.integers(min_value=-1000, max_value=1000), min_size=1, max_size=20))
+    v = create_vector(values, vector_type)
+    for u in (v, v.getView(), v.getConstView()):
+        assert u.sum() == sum(values)
+        assert u.min() == min(values)
+        assert u.max() == max(values)
+        assert u.argMin() == (min(values), values.index(min(values)))
+        assert u.argMax() == (max(values), values.index(max(values)))
+        assert u.l1Norm() == sum(abs(x) for x in values)
+        assert u.l2Norm() == pytest.approx(math.sqrt(sum(x * x for x in values)))
+        assert u.maxNorm() == max(abs(x) for x in values)
+        assert u.lpNorm(3) == pytest.approx(sum(abs(x) ** 3 for x in values) ** (1 / 3))
+        assert u.lpNorm(math.inf) == u.maxNorm()
+        assert u.any() == any(values)
+        assert u.all() == all(values)
+        assert u.dot(v) == sum(x * x for x in values)
+
+
+def test_product() -> None:
+    v = pytnl.containers.Vector[int](10, 2)
+    assert v.product() == 2**10
+    assert pytnl.containers.Vector[float](0).product() == 1.0
+
+
+def test_reductions_complex() -> None:
+    v = create_vector([3 + 4j, -1j, 0], pytnl._containers.Vector_complex)
+    assert v.sum() == 3 + 3j
+    assert v.dot(v) == (3 + 4j) ** 2 + (-1j) ** 2
+    assert v.l1Norm() == pytest.approx(6.0)
+    assert v.l2Norm() == pytest.approx(math.sqrt(26))
+    assert v.maxNorm() == pytest.approx(5.0)
+    assert v.lpNorm(1) == pytest.approx(6.0)
+    assert v.lpNorm(math.inf) == v.maxNorm()
+    assert v.any()
+    assert not v.all()
+    assert not hasattr(v, "max")
+
+
+@pytest.mark.parametrize("vector_type", real_vector_types)
+def test_reductions_empty(vector_type: type[Vreal]) -> None:
+    v = vector_type(0)
+    assert v.sum() == 0
+    assert v.l2Norm() == 0.0
+    assert not v.any()
+    assert v.all()
+    with pytest.raises(ValueError):
+        v.min()
+    with pytest.raises(ValueError):
+        v.argMax()
+    with pytest.raises(ValueError):
+        v.lpNorm(0.5)
+    with pytest.raises(ValueError):
+        v.dot(vector_type(1))
+
+
+def test_reduction_functions() -> None:
+    reductions = pytnl.containers.reductions
+    a = pytnl.containers.Vector[float](100, 3.0)
+    b = pytnl.containers.Vector[float](100, 1.0)
+    b[7] = 0.0
+    assert reductions.sum(a) == 300.0
+    assert reductions.max(b.getView()) == 1.0
+    assert reductions.argMin(b) == (0.0, 7)
+    assert reductions.dot(a, b) == 297.0
+    assert not reductions.all(b)
+
+    # fused reductions of expressions
+    e = pytnl.containers.lazy(a) - b
+    assert reductions.l2Norm(e) == pytest.approx(math.sqrt(99 * 4 + 9))
+    assert reductions.lpNorm(e, 1) == pytest.approx(99 * 2 + 3)
+    assert reductions.maxNorm(e) == 3.0
+    assert reductions.argMax(e) == (3.0, 7)
+    assert reductions.dot(e, b) == pytest.approx(99 * 2)
+    assert reductions.lpNorm(e, 3) == pytest.approx((99 * 8 + 27) ** (1 / 3))
+
+
+def test_float32() -> None:
+    vector_type = pytnl.containers.Vector[np.float32]
+    assert vector_type is pytnl._containers.Vector_float32
+    assert pytnl.containers.VectorView[np.float32] is pytnl._containers.VectorView_float32
+
+    a = vector_type(10, 1.5)
+    b = vector_type(10, 0.25)
+    c = a + 2 * b
+    assert isinstance(c, vector_type)
+    assert list(c) == [2.0] * 10
+    assert c.sum() == 20.0
+
+    data = np.from_dlpack(c)
+    assert data.dtype == np.float32
+    assert np.all(data == 2.0)
+
+    # values are rounded to single precision
+    c[0] = 0.1
+    assert c[0] == float(np.float32(0.1))
+    assert c[0] != 0.1
+
+
+def test_int32() -> None:
+    vector_type = pytnl.containers.Vector[np.int32]
+    assert vector_type is pytnl._containers.Vector_int32
+    assert pytnl.containers.Array[np.int32] is pytnl._containers.Array_int32
+    assert pytnl.containers.VectorView[np.int32] is pytnl._containers.VectorView_int32
+
+    a = vector_type(np.arange(10, dtype=np.int32))
+    b = vector_type(10, 2)
+    c = a * b + 1
+    assert isinstance(c, vector_type)
+    assert list(c) == [2 * i + 1 for i in range(10)]
+    assert c.sum() == 100
+    assert np.from_dlpack(c).dtype == np.int32
+
+    # module functions writing into an existing vector
+    out = vector_type(10)
+    pytnl.containers.add(a, b, out=out)
+    assert list(out) == [i + 2 for i in range(10)]
+
+    # contiguous and strided slices
+    view = a[2:5]
+    assert isinstance(view, pytnl._containers.VectorView_int32)
+    assert list(view) == [2, 3, 4]
+    strided = a[::3]
+    assert isinstance(strided, pytnl._containers.StridedArrayView_int32)
+    assert list(strided) == [0, 3, 6, 9]
+    a[::2] = vector_type(5, -1)
+    assert list(a) == [-1, 1, -1, 3, -1, 5, -1, 7, -1, 9]
+    const_strided = a.getConstView()[1::2]
+    assert isinstance(const_strided, pytnl._containers.StridedArrayView_int32_const)
+    assert list(const_strided) == [1, 3, 5, 7, 9]
+
+    # values out of the range of int32 are rejected
+    with pytest.raises((OverflowError, TypeError)):
+        a[0] = 2**31
+
+
+def test_float16() -> None:
+    vector_type = pytnl.containers.Vector[np.float16]
+    assert vector_type is pytnl._containers.Vector_float16
+    assert pytnl.containers.VectorView[np.float16] is pytnl._containers.VectorView_float16
+
+    a = vector_type(10, 1.5)
+    b = vector_type(10, 0.25)
+    c = a + 2 * b
+    assert isinstance(c, vector_type)
+    assert list(c) == [2.0] * 10
+
+    data = np.from_dlpack(c)
+    assert data.dtype == np.float16
+    assert np.all(data == 2.0)
+    # the buffer protocol uses the "e" format of the struct module
+    assert np.asarray(c).dtype == np.float16
+    assert vector_type(np.arange(5, dtype=np.float16)) == vector_type([0, 1, 2, 3, 4])
+
+    # values are rounded to half precision
+    c[0] = 0.1
+    assert c[0] == float(np.float16(0.1))
+    c[0] = 1e5
+    assert c[0] == math.inf
+    # the rounding from double is direct: the value is above the tie between 1 and 1 + 2**-10,
+    # but rounding to float first would make it an exact tie, which rounds to even (1)
+    c[0] = 1 + 2**-11 + 2**-40
+    assert c[0] == 1 + 2**-10
+    assert vector_type(np.array([1 + 2**-11 + 2**-40])).tolist() == [1 + 2**-10]
+
+    # the sum is accumulated in single precision (in half precision it would stop at 2048)
+    ones = vector_type(100000, 1.0)
+    assert ones.sum() == 100000
+    assert ones.dot(ones) == 100000
+
+
+def test_bfloat16() -> None:
+    vector_type = pytnl.containers.Vector[pytnl.containers.bfloat16]
+    assert vector_type is pytnl._containers.Vector_bfloat16
+
+    a = vector_type(10, 1.5)
+    c = a * a - 0.25
+    assert list(c) == [2.0] * 10
+    assert c.max() == 2.0
+
+    # bfloat16 has the range of float32, but only 8 significant bits
+    c[0] = 1e30
+    assert c[0] == pytest.approx(1e30, rel=2**-8)
+    c[1] = 257
+    assert c[1] == 256
+    c[2] = 1 + 2**-8 + 2**-40
+    assert c[2] == 1 + 2**-7
+
+    # the sum is accumulated in single precision (in bfloat16 it would stop at 256)
+    assert vector_type(1000, 1.0).sum() == 1000
+
+
+def test_random() -> None:
+    n = 100_000
+    a = pytnl._containers.Vector_float(n)
+    a.setRandomUniform(seed=42)
+    values = np.from_dlpack(a)
+    assert values.min() >= 0
+    assert values.max() < 1
+    assert values.mean() == pytest.approx(0.5, abs=0.01)
+
+    # the same seed gives the same numbers, a different seed other numbers
+    b = pytnl._containers.Vector_float(n)
+    b.setRandomUniform(seed=42)
+    assert a == b
+    b.setRandomUniform(seed=43)
+    assert a != b
+
+    # the element i depends only on the counter offset + i, so parts of the stream can be filled separately
+    b.getView(0, n // 2).setRandomUniform(seed=42)
+    b.getView(n // 2, n).setRandomUniform(seed=42, offset=n // 2)
+    assert a == b
+
+    a.setRandomUniform(seed=1, low=-2, high=3)
+    assert np.from_dlpack(a).min() >= -2
+    assert np.from_dlpack(a).mean() == pytest.approx(0.5, abs=0.05)
+    with pytest.raises(ValueError):
+        a.setRandomUniform(seed=1, low=1, high=1)
+
+    a.setRandomNormal(seed=7, mean=1, stddev=2)
+    assert np.from_dlpack(a).mean() == pytest.approx(1, abs=0.05)
+    assert np.from_dlpack(a).std() == pytest.approx(2, rel=0.02)
+    with pytest.raises(ValueError):
+        a.setRandomNormal(seed=7, stddev=-1)
+
+    # single and half precision use the same generator
+    c = pytnl._containers.Vector_float32(n)
+    c.setRandomNormal(seed=7)
+    assert np.from_dlpack(c).std() == pytest.approx(1, rel=0.02)
+    h = pytnl._containers.Vector_float16(10)
+    h.setRandomUniform(seed=7, low=10, high=20)
+    assert all(10 <= x <= 20 for x in h)
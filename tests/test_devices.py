@@ -0,0 +1,30 @@
+import importlib
+
+import pytest
+
+import pytnl._containers
+from pytnl.devices import Host
+
+
+def test_host_set_max_threads_count() -> None:
+    if not Host.isOMPEnabled():
+        pytest.skip("PyTNL was built without OpenMP")
+
+    original = Host.getMaxThreadsCount()
+    try:
+        Host.setMaxThreadsCount(2)
+        assert Host.getMaxThreadsCount() == 2
+
+        # the setting must be applied to all loaded extension modules
+        matrices = importlib.import_module("pytnl.matrices")
+        assert matrices._Host_getMaxThreadsCount() == 2
+        assert pytnl._containers._Host_getMaxThreadsCount() == 2
+    finally:
+        Host.setMaxThreadsCount(original)
+    assert Host.getMaxThreadsCount() == original
+
+
+@pytest.mark.parametrize("count", [0, -1])
+def test_host_set_invalid_max_threads_count(count: int) -> None:
+    with pytest.raises(ValueError):
+        Host.setMaxThreadsCount(count)